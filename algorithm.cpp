@@ -0,0 +1,26 @@
+/* Slider Puzzle Algorithms
+*
+* Algorithm names. See algorithm.h.
+*
+* File:   algorithm.cpp
+*/
+
+#include "algorithm.h"
+
+using namespace std;
+
+bool parseAlgorithm(const string& name, Algorithm& algorithm) {
+	for (int a = BFS; a <= PIDA_PDB; a++) {
+		if (name == algorithmName((Algorithm)a)) {
+			algorithm = (Algorithm)a;
+			return true;
+		}
+	}
+	return false;
+}
+
+string algorithmName(Algorithm algorithm) {
+	const char* names[] = { "bfs", "dfs", "oopl", "mhttn", "db", "ida", "lc", "wd", "idalc", "idawd", "pdb", "idapdb", "bibfs", "hda",
+		"pida", "pidalc", "pidawd", "pidapdb" };
+	return names[algorithm];
+}
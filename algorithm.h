@@ -0,0 +1,44 @@
+/* Slider Puzzle Algorithms
+*
+* The search methods a Solver runs and the names they go by on the command
+* line, in the batch records and in the solution cache log. Kept apart from
+* solver.h so the solution cache can read and write the names without the
+* Solver.
+*
+* File:   algorithm.h
+*/
+
+#ifndef ALGORITHM_H
+#define ALGORITHM_H
+
+#include <string>
+
+// search methods
+enum Algorithm {
+	BFS, // breadth-first search
+	DFS, // depth-first search
+	OOPL, // A* search w/ misplaced tiles heuristic
+	MHTTN, // A* search w/ Manhattan distance heuristic
+	DB, // greedy descent through the distance database
+	IDA, // iterative-deepening A* search w/ Manhattan distance heuristic
+	LC, // A* search w/ Manhattan distance plus linear conflict heuristic
+	WD, // A* search w/ walking distance heuristic
+	IDA_LC, // iterative-deepening A* search w/ Manhattan distance plus linear conflict heuristic
+	IDA_WD, // iterative-deepening A* search w/ walking distance heuristic
+	PDB, // A* search w/ additive pattern database heuristic
+	IDA_PDB, // iterative-deepening A* search w/ additive pattern database heuristic
+	BIBFS, // bidirectional breadth-first search, from the start and the goal at once
+	HDA, // hash-distributed parallel A* search w/ Manhattan distance heuristic, one instance on several cores
+	PIDA, // parallel iterative-deepening A* search w/ Manhattan distance heuristic
+	PIDA_LC, // parallel iterative-deepening A* search w/ Manhattan distance plus linear conflict heuristic
+	PIDA_WD, // parallel iterative-deepening A* search w/ walking distance heuristic
+	PIDA_PDB // parallel iterative-deepening A* search w/ additive pattern database heuristic
+};
+
+// read an algorithm name (bfs, dfs, oopl, mhttn, db, ida, lc, wd, idalc, idawd, pdb, idapdb, bibfs, hda, pida, pidalc, pidawd, pidapdb), return false if it is unknown
+bool parseAlgorithm(const std::string& name, Algorithm& algorithm);
+
+// return the name of an algorithm as parseAlgorithm reads it
+std::string algorithmName(Algorithm algorithm);
+
+#endif
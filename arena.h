@@ -0,0 +1,137 @@
+/* Slider Puzzle Arena
+*
+* Bump storage for the search nodes and index stacks of one Solver. Items are
+* appended to one block that doubles when it fills up and is never shrunk or
+* freed before the arena, so it settles at the size of the largest search.
+* rewind() forgets every item by resetting the fill count: nothing is
+* destroyed or freed, and the next search refills the block from the start.
+* Items are raw copies (trivially copyable), so growing is one memcpy and no
+* item is constructed or destroyed. Searches refer to items by index, which
+* stays valid as the block moves.
+*
+* File:   arena.h
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// items of the first block
+#define ARENA_FIRST_BLOCK 1024
+
+// append-only storage of T indexed like a vector, reused between searches
+template <class T>
+class Arena {
+public:
+
+	static_assert(std::is_trivially_copyable<T>::value, "arena items are moved w/ memcpy and never destroyed");
+
+	Arena() = default;
+
+	// an arena owns its block, it is not copied
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	// append an item, return its index
+	size_t push_back(const T& item);
+
+	// drop the last item (the arena must not be empty)
+	void pop_back();
+
+	// item at an index below size()
+	T& operator[](size_t index);
+	const T& operator[](size_t index) const;
+
+	// last item (the arena must not be empty)
+	T& back();
+
+	// return true if no item is stored
+	bool empty() const;
+
+	// number of items stored
+	size_t size() const;
+
+	// forget every item, the block is kept for the next fill
+	void rewind();
+
+	// bytes held by the block
+	size_t bytes() const;
+
+private:
+
+	// move the items to a block twice the size
+	void grow();
+
+	// storage of the items, uninitialized past "count"
+	std::unique_ptr<T[]> block;
+
+	size_t count = 0; // number of items stored
+
+	size_t capacity = 0; // number of items the block holds
+};
+
+template <class T>
+inline size_t Arena<T>::push_back(const T& item) {
+	if (count == capacity) {
+		grow();
+	}
+	block[count] = item;
+	return count++;
+}
+
+template <class T>
+void Arena<T>::grow() {
+	size_t larger = capacity == 0 ? ARENA_FIRST_BLOCK : capacity * 2;
+	std::unique_ptr<T[]> moved(new T[larger]);
+	if (count > 0) {
+		std::memcpy(moved.get(), block.get(), count * sizeof(T));
+	}
+	block.swap(moved);
+	capacity = larger;
+}
+
+template <class T>
+inline void Arena<T>::pop_back() {
+	count--;
+}
+
+template <class T>
+inline T& Arena<T>::operator[](size_t index) {
+	return block[index];
+}
+
+template <class T>
+inline const T& Arena<T>::operator[](size_t index) const {
+	return block[index];
+}
+
+template <class T>
+inline T& Arena<T>::back() {
+	return block[count - 1];
+}
+
+template <class T>
+inline bool Arena<T>::empty() const {
+	return count == 0;
+}
+
+template <class T>
+inline size_t Arena<T>::size() const {
+	return count;
+}
+
+template <class T>
+inline void Arena<T>::rewind() {
+	count = 0;
+}
+
+template <class T>
+inline size_t Arena<T>::bytes() const {
+	return capacity * sizeof(T);
+}
+
+#endif
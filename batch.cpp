@@ -0,0 +1,304 @@
+/* Slider Puzzle Batch Mode
+*
+* Batch input, the worker pool and the record writer. See batch.h.
+*
+* File:   batch.cpp
+*/
+
+#include "batch.h"
+#include "heuristics.h"
+
+#include <cstdlib>
+#include <cctype>
+#include <iostream>
+#include <algorithm>
+#include <sstream>
+#include <fstream>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+using namespace std;
+
+void ResultWriter::write(const string& record) {
+	buffer += record;
+	if (buffer.size() >= 65536) {
+		flush();
+	}
+}
+
+void ResultWriter::flush() {
+	stream->write(buffer.data(), buffer.size());
+	stream->flush();
+	buffer.clear();
+}
+
+template <class P>
+string batchRecord(Solver<P>& solver, int index, string line, Algorithm algorithm,
+	const SolveOptions& options, const string& format, bool withStats) {
+
+	// keep malformed lines from breaking the record format
+	if (!P::validState(line)) {
+		line.erase(remove_if(line.begin(), line.end(), [](char c) { return !isalnum((unsigned char)c) && c != ','; }), line.end());
+	}
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	SolveResult result = solver.solve(line, algorithm, options);
+
+	long long micros = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+	// only a solved state has a depth
+	int depth = result.status == SOLVED ? result.depth : -1;
+	int nodes = result.nodes;
+	string path = result.status == SOLVED ? result.compactPath() : "";
+	string status = statusName(result.status);
+	string name = algorithmName(algorithm);
+
+	// build one record
+	stringstream record;
+	if (format == "csv") {
+
+		// comma-separated states (boards above 3x3) are quoted to stay one field
+		string start = line.find(',') != string::npos ? '"' + line + '"' : line;
+		record << index << ',' << start << ',' << name << ',' << status << ','
+			<< depth << ',' << nodes << ',' << micros << ',' << path;
+		if (withStats) {
+			record << ',' << statsCsv(result.stats);
+		}
+		record << '\n';
+	}
+	else {
+		record << "{\"index\":" << index << ",\"start\":\"" << line << "\",\"algorithm\":\"" << name
+			<< "\",\"status\":\"" << status << "\",\"depth\":" << depth << ",\"nodes\":" << nodes
+			<< ",\"time_us\":" << micros << ",\"path\":\"" << path << "\"";
+		if (withStats) {
+			record << ",\"stats\":" << statsJson(result.stats);
+		}
+		record << "}\n";
+	}
+	return record.str();
+}
+
+int runBatch(int argc, char* argv[]) {
+
+	const string usage = "usage: --batch <bfs|dfs|oopl|mhttn|db|ida|lc|wd|idalc|idawd|pdb|idapdb|bibfs|hda|pida|pidalc|pidawd|pidapdb> [input|-] [--out file] [--format csv|jsonl] [--threads n] [--size 3x3|4x4|5x5] [--stats] [--cache n] [--cache-log file]";
+
+	if (argc < 3) {
+		cerr << usage << endl;
+		return 1;
+	}
+
+	Algorithm algorithm;
+	bool known = parseAlgorithm(argv[2], algorithm);
+	string inputName = "-"; // "-" reads stdin
+	string outputName; // empty writes to stdout
+	string format = "csv";
+	string size = "3x3";
+	int threadCount = (int)thread::hardware_concurrency(); // one worker per core by default
+	bool withStats = false;
+	long long cacheSize = 0; // no solution cache unless asked for
+	string cacheLog;
+
+	// read the remaining options
+	for (int i = 3; i < argc; i++) {
+		string arg = argv[i];
+		if (arg == "--out" && i + 1 < argc) {
+			outputName = argv[++i];
+		}
+		else if (arg == "--format" && i + 1 < argc) {
+			format = argv[++i];
+		}
+		else if (arg == "--threads" && i + 1 < argc) {
+			threadCount = atoi(argv[++i]);
+		}
+		else if (arg == "--size" && i + 1 < argc) {
+			size = argv[++i];
+		}
+		else if (arg == "--stats") {
+			withStats = true;
+		}
+		else if (arg == "--cache" && i + 1 < argc) {
+			cacheSize = atoll(argv[++i]);
+		}
+		else if (arg == "--cache-log" && i + 1 < argc) {
+			cacheLog = argv[++i];
+		}
+		else if (arg[0] != '-' || arg == "-") {
+			inputName = arg;
+		}
+		else {
+			cerr << usage << endl;
+			return 1;
+		}
+	}
+
+	if (!known || (format != "csv" && format != "jsonl")) {
+		cerr << usage << endl;
+		return 1;
+	}
+	if (threadCount < 1) {
+		threadCount = 1;
+	}
+
+	// a log alone gets the default capacity
+	unique_ptr<SolutionCache> cache;
+	if (cacheSize > 0 || !cacheLog.empty()) {
+		cache.reset(new SolutionCache(cacheSize > 0 ? (size_t)cacheSize : SOLUTION_CACHE_SIZE));
+		if (!cacheLog.empty() && !cache->openLog(cacheLog)) {
+			cerr << "Cannot open " << cacheLog << endl;
+			return 1;
+		}
+	}
+
+	// each board size runs its own specialized solvers
+	if (size == "3x3") {
+		return solveBatch<Puzzle8>(algorithm, inputName, outputName, format, threadCount, withStats, cache.get());
+	}
+	else if (size == "4x4") {
+		return solveBatch<Puzzle15>(algorithm, inputName, outputName, format, threadCount, withStats, cache.get());
+	}
+	else if (size == "5x5") {
+		return solveBatch<Puzzle24>(algorithm, inputName, outputName, format, threadCount, withStats, cache.get());
+	}
+	cerr << usage << endl;
+	return 1;
+}
+
+template <class P>
+int solveBatch(Algorithm algorithm, const string& inputName, const string& outputName,
+	const string& format, int threadCount, bool withStats, SolutionCache* cache) {
+
+	// the database algorithm needs a built distance database, shared by every worker
+	DistanceDatabase database;
+	SolveOptions options;
+	options.cache = cache;
+	if (algorithm == DB) {
+		if (!is_same<P, Puzzle8>::value) {
+			cerr << "The distance database only covers the 3x3 board!" << endl;
+			return 1;
+		}
+		if (!database.open(DATABASE_FILE)) {
+			cerr << "Build the distance database (" << DATABASE_FILE << ") before using it!" << endl;
+			return 1;
+		}
+		options.database = &database;
+	}
+
+	// HDA* and the parallel IDA* spread each instance over the workers, so the instances take turns
+	if (algorithm == HDA || algorithm == PIDA || algorithm == PIDA_LC || algorithm == PIDA_WD || algorithm == PIDA_PDB) {
+		options.threads = threadCount;
+		threadCount = 1;
+	}
+
+	// the walking distance tables only cover boards up to 4x4
+	if ((algorithm == WD || algorithm == IDA_WD || algorithm == PIDA_WD) && !hasWalkingDistance<P>()) {
+		cerr << "The walking distance only covers boards up to 4x4!" << endl;
+		return 1;
+	}
+
+	// the pattern database algorithms need the board size's pattern databases, shared the same way
+	// The first run on a board size builds them w/ the default partition.
+	PatternDatabaseSet patterns;
+	if (algorithm == PDB || algorithm == IDA_PDB || algorithm == PIDA_PDB) {
+		string patternName = patternFile(P::ROW, P::COL);
+		if (!patterns.open(patternName, P::ROW, P::COL)) {
+			cerr << "Building the pattern databases (" << patternName << ")..." << endl;
+			if (!PatternDatabaseSet::build(patternName, P::ROW, P::COL, defaultPartition(P::ROW, P::COL))
+				|| !patterns.open(patternName, P::ROW, P::COL)) {
+				cerr << "The pattern databases could not be written!" << endl;
+				return 1;
+			}
+		}
+		options.patterns = &patterns;
+	}
+
+	ifstream inputFile;
+	if (inputName != "-") {
+		inputFile.open(inputName.c_str());
+		if (!inputFile) {
+			cerr << "Cannot open " << inputName << endl;
+			return 1;
+		}
+	}
+	istream& input = inputName != "-" ? inputFile : cin;
+
+	// read every start state up front so the workers can share them out
+	vector<string> states;
+	string line;
+	while (getline(input, line)) {
+
+		// trim whitespace and skip blank lines
+		line.erase(remove_if(line.begin(), line.end(), ::isspace), line.end());
+		if (!line.empty()) {
+			states.push_back(line);
+		}
+	}
+
+	// open the output once, in append mode
+	ofstream outputFile;
+	ResultWriter writer;
+	writer.stream = &cout;
+	bool newFile = true;
+	if (!outputName.empty()) {
+		ifstream existing(outputName.c_str(), ios::binary | ios::ate);
+		newFile = !existing || existing.tellg() == 0;
+		outputFile.open(outputName.c_str(), ios::binary | ios::app);
+		if (!outputFile) {
+			cerr << "Cannot open " << outputName << endl;
+			return 1;
+		}
+		writer.stream = &outputFile;
+	}
+
+	if (format == "csv" && newFile) {
+		writer.write("index,start,algorithm,status,depth,nodes,time_us,path" + (withStats ? "," + statsCsvHeader() : "") + "\n");
+	}
+
+	// deal the instances out round-robin, stealing evens out the deep ones
+	vector<WorkQueue> queues(threadCount);
+	for (unsigned int i = 0; i < states.size(); i++) {
+		queues[i % threadCount].items.push_back(i);
+	}
+
+	// finished records wait here until every earlier record has been written
+	mutex outputLock;
+	vector<string> records(states.size());
+	vector<bool> ready(states.size(), false);
+	unsigned int nextRecord = 0;
+
+	vector<thread> workers;
+	for (int w = 0; w < threadCount; w++) {
+		workers.push_back(thread([&, w]() {
+
+			Solver<P> solver; // this worker's own search state
+
+			int index;
+			while (takeWork(queues, w, index)) {
+				string record = batchRecord(solver, index, states[index], algorithm, options, format, withStats);
+
+				// write records in input order
+				lock_guard<mutex> guard(outputLock);
+				records[index].swap(record);
+				ready[index] = true;
+				while (nextRecord < states.size() && ready[nextRecord]) {
+					writer.write(records[nextRecord]);
+					string().swap(records[nextRecord]);
+					nextRecord++;
+				}
+			}
+		}));
+	}
+
+	for (unsigned int w = 0; w < workers.size(); w++) {
+		workers[w].join();
+	}
+
+	writer.flush();
+
+	if (cache != NULL) {
+		cerr << "cache: " << cache->hits() << " hits, " << cache->misses() << " misses, " << cache->size() << " solutions held" << endl;
+	}
+	return 0;
+}
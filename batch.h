@@ -0,0 +1,59 @@
+/* Slider Puzzle Batch Mode
+*
+* "--batch <algorithm> [input] [--out file] [--format csv|jsonl] [--threads n]
+* [--size 3x3|4x4|5x5] [--stats] [--cache n] [--cache-log file]" solves one
+* start state per input line (stdin when the input is omitted or "-") on a
+* board of the given size (3x3 by default). One record per state is appended
+* to the output file (stdout by default) through a buffered writer. "--stats"
+* adds the search stats (search_stats.h) to every record, as extra columns or
+* a "stats" object. The states are spread over a pool of workers, one per core
+* by default, each with its own Solver; records keep input order. The hda and
+* pida algorithms instead solve the states one at a time, each on all the
+* workers. "--cache" puts a solution cache of that many states in front of the
+* workers, and "--cache-log" keeps it in a log file between runs
+* (solution_cache.h).
+*
+* File:   batch.h
+*/
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "solver.h"
+#include "work_queue.h"
+
+// buffered append-only writer for batch result records
+// Records collect in memory and reach the stream in large blocks, the file is
+// opened once per run in append mode and never truncated.
+struct ResultWriter {
+
+	std::ostream* stream; // output stream, a file or cout
+
+	std::string buffer; // pending records
+
+	// queue a record, flush once the buffer passes 64 KB
+	void write(const std::string& record);
+
+	// hand the pending records to the stream
+	void flush();
+};
+
+// solve one batch start state and return its output record
+template <class P>
+std::string batchRecord(Solver<P>& solver, int index, std::string line, Algorithm algorithm,
+	const SolveOptions& options, const std::string& format, bool withStats);
+
+// solve every start state from the batch input on a pool of workers, for one board size
+template <class P>
+int solveBatch(Algorithm algorithm, const std::string& inputName, const std::string& outputName,
+	const std::string& format, int threadCount, bool withStats, SolutionCache* cache);
+
+// read the batch options and solve every start state on the chosen board size, one record per state
+int runBatch(int argc, char* argv[]);
+
+#endif
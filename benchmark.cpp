@@ -0,0 +1,362 @@
+/* Slider Puzzle Benchmark
+*
+* Instance sets, the timed runs, the JSON report and the baseline check. See
+* benchmark.h.
+*
+* File:   benchmark.cpp
+*/
+
+#include "benchmark.h"
+#include "level_bfs.h"
+#include "heuristics.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <map>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+// the board the instance sets are drawn on, the only one w/ exact depths for every state
+typedef Puzzle8 P;
+
+vector<BenchInstance> benchInstances(unsigned int seed, int count) {
+
+	// optimal depth of every canonical state, the goal's distance from it (and from its mirror)
+	bool mirrored;
+	LevelBfs bfs(P::CANONICAL_SPACE, 0);
+	vector<uint8_t> canonicalDepth = bfs.run({ (uint32_t)P::rankCanonical(P::GOALSTATE, mirrored) },
+		[](uint32_t rank, uint32_t child[], int cost[]) {
+			P::Board state = P::unrankCanonical(rank);
+			bool mirrored;
+			int children = 0;
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[state.blank][move];
+				if (to >= 0) {
+					child[children] = P::rankCanonical(P::slideBlank(state, to), mirrored);
+					cost[children] = 1;
+					children++;
+				}
+			}
+			return children;
+		});
+
+	// every state's depth, so the draws below pick the same instances as over the full space
+	vector<uint8_t> depth(P::STATE_SPACE);
+	for (int rank = 0; rank < P::STATE_SPACE; rank++) {
+		depth[rank] = canonicalDepth[P::rankCanonical(P::unrankState(rank), mirrored)];
+	}
+
+	// ranks of each bucket in rank order
+	vector<vector<int> > buckets;
+	for (int rank = 0; rank < P::STATE_SPACE; rank++) {
+		if (depth[rank] == 0 || depth[rank] == 0xFF) {
+			continue;
+		}
+		unsigned int bucket = (depth[rank] - 1) / BENCH_BUCKET_WIDTH;
+		if (bucket >= buckets.size()) {
+			buckets.resize(bucket + 1);
+		}
+		buckets[bucket].push_back(rank);
+	}
+
+	// a partial shuffle draws each bucket's instances, w/ a plain modulo so every
+	// standard library draws the same ones (the distributions are not portable)
+	mt19937 random(seed);
+	vector<BenchInstance> instances;
+	for (unsigned int b = 0; b < buckets.size(); b++) {
+		vector<int>& ranks = buckets[b];
+		int draws = min(count, (int)ranks.size());
+		for (int i = 0; i < draws; i++) {
+			int pick = i + (int)(random() % (ranks.size() - i));
+			swap(ranks[i], ranks[pick]);
+
+			BenchInstance instance;
+			instance.state = P::unpackState(P::unrankState(ranks[i]));
+			instance.depth = depth[ranks[i]];
+			instance.bucket = b;
+			instances.push_back(instance);
+		}
+	}
+	return instances;
+}
+
+string bucketName(int bucket) {
+	stringstream name;
+	name << bucket * BENCH_BUCKET_WIDTH + 1 << '-' << (bucket + 1) * BENCH_BUCKET_WIDTH;
+	return name.str();
+}
+
+// nearest-rank percentile of sorted times, in microseconds
+static double percentile(const vector<long long>& sorted, int percent) {
+	if (sorted.empty()) {
+		return 0;
+	}
+	size_t rank = (sorted.size() * percent + 99) / 100;
+	return sorted[rank > 0 ? rank - 1 : 0] / 1000.0;
+}
+
+string benchRecord(const BenchResult& result) {
+	vector<long long> sorted(result.nanos);
+	sort(sorted.begin(), sorted.end());
+
+	long long total = 0;
+	for (unsigned int i = 0; i < sorted.size(); i++) {
+		total += sorted[i];
+	}
+
+	double seconds = total / 1e9;
+	double nodesPerSecond = seconds > 0 ? result.generated / seconds : 0;
+	double nsPerExpansion = result.expanded > 0 ? (double)total / result.expanded : 0;
+
+	stringstream record;
+	record << fixed << setprecision(1);
+	record << "{\"algorithm\":\"" << result.algorithm << "\",\"bucket\":\"" << bucketName(result.bucket)
+		<< "\",\"instances\":" << result.instances << ",\"solved\":" << result.solved
+		<< ",\"expanded\":" << result.expanded << ",\"generated\":" << result.generated
+		<< ",\"nodes_per_sec\":" << nodesPerSecond << ",\"ns_per_expansion\":" << nsPerExpansion
+		<< ",\"p50_us\":" << percentile(sorted, 50) << ",\"p90_us\":" << percentile(sorted, 90)
+		<< ",\"p99_us\":" << percentile(sorted, 99) << ",\"max_us\":" << percentile(sorted, 100)
+		<< ",\"total_us\":" << total / 1000.0 << ",\"peak_bytes\":" << result.peakBytes << "}";
+	return record.str();
+}
+
+// raw value of a key on one report line ("" if missing), strings w/o their quotes
+static string jsonValue(const string& line, const string& key) {
+	string pattern = "\"" + key + "\":";
+	size_t start = line.find(pattern);
+	if (start == string::npos) {
+		return "";
+	}
+	start += pattern.size();
+	if (start < line.size() && line[start] == '"') {
+		size_t end = line.find('"', start + 1);
+		return end == string::npos ? "" : line.substr(start + 1, end - start - 1);
+	}
+	size_t end = line.find_first_of(",}", start);
+	return line.substr(start, end == string::npos ? string::npos : end - start);
+}
+
+int compareBaseline(const vector<BenchResult>& results, const string& baselineName, double tolerance) {
+	ifstream baseline(baselineName.c_str());
+	if (!baseline) {
+		cerr << "Cannot open " << baselineName << endl;
+		return -1;
+	}
+
+	// generated nodes and median time of each algorithm and bucket in the baseline
+	map<string, pair<double, double> > before;
+	string line;
+	while (getline(baseline, line)) {
+		string algorithm = jsonValue(line, "algorithm");
+		if (!algorithm.empty()) {
+			before[algorithm + ' ' + jsonValue(line, "bucket")] =
+				make_pair(atof(jsonValue(line, "generated").c_str()), atof(jsonValue(line, "p50_us").c_str()));
+		}
+	}
+
+	int regressions = 0;
+	for (unsigned int i = 0; i < results.size(); i++) {
+		string key = results[i].algorithm + ' ' + bucketName(results[i].bucket);
+		map<string, pair<double, double> >::const_iterator old = before.find(key);
+		if (old == before.end()) {
+			continue;
+		}
+
+		string record = benchRecord(results[i]);
+		double now[2] = { atof(jsonValue(record, "generated").c_str()), atof(jsonValue(record, "p50_us").c_str()) };
+		double was[2] = { old->second.first, old->second.second };
+		const char* metric[2] = { "generated", "p50_us" };
+		for (int m = 0; m < 2; m++) {
+			if (was[m] > 0 && now[m] > was[m] * (1 + tolerance / 100)) {
+				cerr << "regression: " << key << ' ' << metric[m] << ' ' << was[m] << " -> " << now[m]
+					<< " (+" << fixed << setprecision(1) << (now[m] / was[m] - 1) * 100 << "%)" << endl;
+				cerr.unsetf(ios::fixed);
+				regressions++;
+			}
+		}
+	}
+	return regressions;
+}
+
+// open (and on the first run build) the databases the algorithms need, return false if one cannot be had
+static bool openDatabases(const vector<Algorithm>& algorithms, DistanceDatabase& database,
+	PatternDatabaseSet& patterns, SolveOptions& options) {
+
+	for (unsigned int a = 0; a < algorithms.size(); a++) {
+		Algorithm algorithm = algorithms[a];
+		if (algorithm == DB && options.database == NULL) {
+			if (!database.open(DATABASE_FILE)) {
+				cerr << "Building the distance database (" << DATABASE_FILE << ")..." << endl;
+				if (!DistanceDatabase::build(DATABASE_FILE) || !database.open(DATABASE_FILE)) {
+					cerr << "The distance database could not be written!" << endl;
+					return false;
+				}
+			}
+			options.database = &database;
+		}
+		if ((algorithm == PDB || algorithm == IDA_PDB || algorithm == PIDA_PDB) && options.patterns == NULL) {
+			string patternName = patternFile(P::ROW, P::COL);
+			if (!patterns.open(patternName, P::ROW, P::COL)) {
+				cerr << "Building the pattern databases (" << patternName << ")..." << endl;
+				if (!PatternDatabaseSet::build(patternName, P::ROW, P::COL, defaultPartition(P::ROW, P::COL))
+					|| !patterns.open(patternName, P::ROW, P::COL)) {
+					cerr << "The pattern databases could not be written!" << endl;
+					return false;
+				}
+			}
+			options.patterns = &patterns;
+		}
+	}
+	return true;
+}
+
+int runBenchmark(int argc, char* argv[]) {
+
+	const string usage = "usage: --bench [--algorithms a,b,...] [--count n] [--seed n] [--threads n] [--out file] [--label text] [--baseline file] [--tolerance percent]";
+
+	vector<Algorithm> algorithms;
+	int count = 10; // instances per bucket
+	unsigned int seed = 1;
+	int threads = 0; // workers of the parallel searches, 0 for one per core
+	string outputName; // empty writes to stdout
+	string label;
+	string baselineName;
+	double tolerance = 10;
+
+	// read the options
+	for (int i = 2; i < argc; i++) {
+		string arg = argv[i];
+		if (arg == "--algorithms" && i + 1 < argc) {
+			stringstream names(argv[++i]);
+			string name;
+			while (getline(names, name, ',')) {
+				Algorithm algorithm;
+				if (!parseAlgorithm(name, algorithm)) {
+					cerr << "Unknown algorithm " << name << endl;
+					return 1;
+				}
+				algorithms.push_back(algorithm);
+			}
+		}
+		else if (arg == "--count" && i + 1 < argc) {
+			count = atoi(argv[++i]);
+		}
+		else if (arg == "--seed" && i + 1 < argc) {
+			seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+		}
+		else if (arg == "--threads" && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		}
+		else if (arg == "--out" && i + 1 < argc) {
+			outputName = argv[++i];
+		}
+		else if (arg == "--label" && i + 1 < argc) {
+			label = argv[++i];
+		}
+		else if (arg == "--baseline" && i + 1 < argc) {
+			baselineName = argv[++i];
+		}
+		else if (arg == "--tolerance" && i + 1 < argc) {
+			tolerance = atof(argv[++i]);
+		}
+		else {
+			cerr << usage << endl;
+			return 1;
+		}
+	}
+
+	if (count < 1 || threads < 0 || tolerance < 0) {
+		cerr << usage << endl;
+		return 1;
+	}
+
+	// every algorithm by default
+	if (algorithms.empty()) {
+		for (int a = BFS; a <= PIDA_PDB; a++) {
+			algorithms.push_back((Algorithm)a);
+		}
+	}
+
+	DistanceDatabase database;
+	PatternDatabaseSet patterns;
+	SolveOptions options;
+	options.threads = threads;
+	if (!openDatabases(algorithms, database, patterns, options)) {
+		return 1;
+	}
+
+	vector<BenchInstance> instances = benchInstances(seed, count);
+	int bucketCount = instances.empty() ? 0 : instances.back().bucket + 1;
+
+	vector<BenchResult> results;
+	for (unsigned int a = 0; a < algorithms.size(); a++) {
+		Algorithm algorithm = algorithms[a];
+
+		// one Solver per algorithm, reused by all its solves as the menu and batch workers do, so its bytes are its own
+		Solver<P> solver;
+		cerr << "Running " << algorithmName(algorithm) << "..." << endl;
+
+		// one untimed solve fills the caches and grows the Solver's buffers
+		solver.solve(instances[0].state, algorithm, options);
+
+		vector<BenchResult> buckets(bucketCount);
+		for (unsigned int i = 0; i < instances.size(); i++) {
+			const BenchInstance& instance = instances[i];
+
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			SolveResult result = solver.solve(instance.state, algorithm, options);
+			long long nanos = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+
+			BenchResult& bucket = buckets[instance.bucket];
+			bucket.instances++;
+			bucket.solved += result.status == SOLVED ? 1 : 0;
+			bucket.expanded += result.stats.expanded;
+			bucket.generated += result.stats.generated;
+			bucket.nanos.push_back(nanos);
+			SearchStats::raise(bucket.peakBytes, result.stats.bytes);
+		}
+
+		for (int b = 0; b < bucketCount; b++) {
+			buckets[b].algorithm = algorithmName(algorithm);
+			buckets[b].bucket = b;
+			results.push_back(buckets[b]);
+		}
+	}
+
+	// one JSON document, one result per line so line tools (and the baseline check) can scan it
+	stringstream report;
+	report << "{\"label\":\"" << label << "\",\"board\":\"3x3\",\"seed\":" << seed << ",\"count\":" << count
+		<< ",\"threads\":" << threads << ",\"kernels\":\"" << heuristicKernelName() << "\",\"results\":[\n";
+	for (unsigned int r = 0; r < results.size(); r++) {
+		report << benchRecord(results[r]) << (r + 1 < results.size() ? ",\n" : "\n");
+	}
+	report << "]}\n";
+
+	if (outputName.empty()) {
+		cout << report.str();
+	}
+	else {
+		ofstream output(outputName.c_str(), ios::binary);
+		if (!output) {
+			cerr << "Cannot open " << outputName << endl;
+			return 1;
+		}
+		output << report.str();
+	}
+
+	if (!baselineName.empty()) {
+		int regressions = compareBaseline(results, baselineName, tolerance);
+		if (regressions != 0) {
+			return 1;
+		}
+		cerr << "No regressions against " << baselineName << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,82 @@
+/* Slider Puzzle Benchmark
+*
+* "--bench [--algorithms a,b,...] [--count n] [--seed n] [--threads n]
+* [--out file] [--label text] [--baseline file] [--tolerance percent]" runs
+* the searches over a fixed instance set and writes one JSON report.
+*
+* The instances are 3x3 states drawn w/ a seeded mt19937 from every state at a
+* given optimal depth, "count" per bucket of BENCH_BUCKET_WIDTH depths. The
+* optimal depths come from one breadth-first pass over the ranked state space
+* (level_bfs.h), so the same seed gives the same instances on every machine.
+* Each algorithm (all of them by default) gets one untimed warm-up solve, then
+* solves every instance on one Solver. A report line per algorithm and bucket
+* holds the solved count, nodes expanded and generated, nodes per second,
+* nanoseconds per expansion, the 50th/90th/99th percentile and largest solve
+* time, and the most bytes the search storage held after a solve (the node
+* pool, open lists and visited set of the algorithm's own Solver, see
+* search_stats.h).
+*
+* With a baseline report (an earlier run, e.g. on another commit), every
+* bucket whose generated nodes or median time grew by more than the tolerance
+* (10% by default) is listed on stderr and the run exits w/ status 1.
+*
+* File:   benchmark.h
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <string>
+#include <vector>
+
+#include "solver.h"
+
+// optimal depths per instance bucket: 1-4, 5-8, ... 29-32
+#define BENCH_BUCKET_WIDTH 4
+
+// one benchmark start state
+struct BenchInstance {
+
+	std::string state; // start state in string form
+
+	int depth; // optimal number of moves
+
+	int bucket; // index of the depth bucket
+};
+
+// totals of one algorithm over one bucket
+struct BenchResult {
+
+	std::string algorithm; // algorithm name as parseAlgorithm reads it
+
+	int bucket = 0; // index of the depth bucket
+
+	int instances = 0; // number of instances run
+
+	int solved = 0; // number of instances solved
+
+	long long expanded = 0; // nodes expanded over every instance
+
+	long long generated = 0; // nodes generated over every instance
+
+	std::vector<long long> nanos; // solve time of each instance in nanoseconds
+
+	long long peakBytes = 0; // most bytes held by the search storage after a solve of the bucket
+};
+
+// draw "count" 3x3 instances per depth bucket w/ a seeded generator, in bucket order
+std::vector<BenchInstance> benchInstances(unsigned int seed, int count);
+
+// depth range of a bucket ("1-4")
+std::string bucketName(int bucket);
+
+// write one result as a line of the JSON report
+std::string benchRecord(const BenchResult& result);
+
+// compare results w/ a baseline report, print every regression past "tolerance" percent and return their number
+int compareBaseline(const std::vector<BenchResult>& results, const std::string& baselineName, double tolerance);
+
+// read the benchmark options, run the benchmark and write its report
+int runBenchmark(int argc, char* argv[]);
+
+#endif
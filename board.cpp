@@ -0,0 +1,440 @@
+/* Slider Puzzle Board
+*
+* Packing, ranking and heuristic functions for the Board type. See board.h.
+*
+* File:   board.cpp
+*/
+
+#include "board.h"
+
+#include <cstdlib>
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+template <int Rows, int Cols>
+string Puzzle<Rows, Cols>::goalString() {
+	return unpackState(GOALSTATE);
+}
+
+template <int Rows, int Cols>
+string Puzzle<Rows, Cols>::moveLabel(int cell, int move) {
+	return to_string(cell + 1) + " to " + to_string(NEIGHBORS[cell][move] + 1) + ",";
+}
+
+// read the tiles of a string state, one character per cell on the 3x3 board, comma-separated above
+template <int Rows, int Cols>
+bool Puzzle<Rows, Cols>::readCells(const string& state, int cells[]) {
+	vector<string> tokens;
+	if (CELLS <= 9) {
+		for (unsigned int i = 0; i < state.length(); i++) {
+			tokens.push_back(string(1, state[i]));
+		}
+	}
+	else {
+		stringstream tiles(state);
+		string token;
+		while (getline(tiles, token, ',')) {
+			tokens.push_back(token);
+		}
+	}
+
+	if (tokens.size() != CELLS) {
+		return false;
+	}
+
+	// every tile and the empty tile must appear exactly once
+	bool seen[CELLS] = {};
+	for (int i = 0; i < CELLS; i++) {
+		int tile = 0;
+		if (tokens[i] != "E") {
+			if (tokens[i].empty() || tokens[i].length() > 2
+				|| !all_of(tokens[i].begin(), tokens[i].end(), [](char c) { return isdigit((unsigned char)c) != 0; })) {
+				return false;
+			}
+			tile = atoi(tokens[i].c_str());
+			if (tile < 1 || tile >= CELLS) {
+				return false;
+			}
+		}
+
+		if (seen[tile]) {
+			return false;
+		}
+		seen[tile] = true;
+		cells[i] = tile;
+	}
+	return true;
+}
+
+// pack a string state into a Board, 'E' becomes the blank tile 0
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::packState(const string& state) {
+	int cells[CELLS] = {};
+	readCells(state, cells);
+
+	Board board = { 0, 0 };
+	for (int i = 0; i < CELLS; i++) {
+		if (cells[i] == 0) {
+			board.blank = i;
+		}
+		else {
+			board.tiles |= (Tiles)cells[i] << (BITS * i);
+		}
+	}
+	return board;
+}
+
+// unpack a Board into a string state, the blank tile 0 becomes 'E'
+template <int Rows, int Cols>
+string Puzzle<Rows, Cols>::unpackState(const Board& board) {
+	string state;
+	for (int i = 0; i < CELLS; i++) {
+		int tile = tileAt(board, i);
+
+		// tiles above 9 need a separator
+		if (CELLS > 9 && i > 0) {
+			state += ',';
+		}
+
+		if (tile == 0) {
+			state += 'E';
+		}
+		else {
+			state += to_string(tile);
+		}
+	}
+	return state;
+}
+
+template <int Rows, int Cols>
+bool Puzzle<Rows, Cols>::validState(const string& state) {
+	int cells[CELLS];
+	return readCells(state, cells);
+}
+
+template <int Rows, int Cols>
+int Puzzle<Rows, Cols>::tileAt(const Board& board, int cell) {
+	return (int)((board.tiles >> (BITS * cell)) & ((1 << BITS) - 1));
+}
+
+template <int Rows, int Cols>
+void Puzzle<Rows, Cols>::tileCells(const Board& board, int where[]) {
+	for (int cell = 0; cell < CELLS; cell++) {
+		where[tileAt(board, cell)] = cell;
+	}
+}
+
+// print a Board as a 2D puzzle - used for testing/debugging
+template <int Rows, int Cols>
+void Puzzle<Rows, Cols>::printPuzzle(const Board& state) {
+	cout << "The Puzzle" << endl;
+	for (int i = 0; i < ROW; i++) {
+		for (int j = 0; j < COL; j++) {
+			int tile = tileAt(state, i * COL + j);
+			if (tile == 0) {
+				cout << 'E' << "\t";
+			}
+			else {
+				cout << tile << "\t";
+			}
+		}
+		cout << endl;
+	}
+	cout << endl;
+}
+
+// slide the tile on cell "to" into the blank cell, the blank moves to "to"
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::slideBlank(const Board& state, int to) {
+	Tiles tile = (state.tiles >> (BITS * to)) & ((1 << BITS) - 1);
+
+	Board child;
+	child.tiles = state.tiles ^ (tile << (BITS * to)) ^ (tile << (BITS * state.blank));
+	child.blank = to;
+	return child;
+}
+
+// rank a state to a dense index in [0, cells!/2)
+// The blank cell selects a block of (cells - 1)!/2 entries and the halved
+// Lehmer code of the tiles selects the entry. Every state reachable from a
+// start has the same tile permutation parity for each blank cell, so halving
+// never merges two of them.
+template <int Rows, int Cols>
+int Puzzle<Rows, Cols>::rankState(const Board& state) {
+	int tiles[CELLS - 1]; // tile values in board order with the blank removed
+	int count = 0;
+	for (int i = 0; i < CELLS; i++) {
+		if (i != state.blank) {
+			tiles[count] = tileAt(state, i);
+			count++;
+		}
+	}
+
+	// Lehmer code of the tile order, built in factorial base
+	int rank = 0;
+	for (int i = 0; i < CELLS - 1; i++) {
+		int smaller = 0;
+		for (int j = i + 1; j < CELLS - 1; j++) {
+			if (tiles[j] < tiles[i]) {
+				smaller++;
+			}
+		}
+		rank = rank * (CELLS - 1 - i) + smaller;
+	}
+	return state.blank * (STATE_SPACE / CELLS) + rank / 2;
+}
+
+// the solvable state of a rank, the inverse of rankState()
+// The halved code stands for two tile orders that differ by a swap of the last
+// two tiles, so exactly one of them has the goal's parity.
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::unrankState(int rank) {
+	const int block = RANKED ? STATE_SPACE / CELLS : 1; // entries per blank cell
+	Board state = { 0, rank / block };
+	int code = rank % block * 2;
+
+	// factorial base digits of the Lehmer code, the last one varies fastest
+	int digit[CELLS - 1];
+	for (int i = CELLS - 2; i >= 0; i--) {
+		digit[i] = code % (CELLS - 1 - i);
+		code /= CELLS - 1 - i;
+	}
+
+	// each digit picks the digit-th smallest tile not placed yet
+	int tiles[CELLS - 1];
+	bool used[CELLS] = {};
+	for (int i = 0; i < CELLS - 1; i++) {
+		int tile = 1;
+		for (int skip = digit[i]; skip > 0 || used[tile]; tile++) {
+			if (!used[tile]) {
+				skip--;
+			}
+		}
+		tiles[i] = tile;
+		used[tile] = true;
+	}
+
+	for (int pass = 0; pass < 2; pass++) {
+		state.tiles = 0;
+		for (int i = 0, count = 0; i < CELLS; i++) {
+			if (i != state.blank) {
+				state.tiles |= (Tiles)tiles[count] << (BITS * i);
+				count++;
+			}
+		}
+		if (isSolvableState(state)) {
+			break;
+		}
+		swap(tiles[CELLS - 3], tiles[CELLS - 2]);
+	}
+	return state;
+}
+
+// move every tile to the mirror of its cell under its mirrored label, a chunk of cells per table lookup
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::mirrorState(const Board& state) {
+	if (!SYMMETRIC) {
+		return state;
+	}
+
+	const int chunkBits = MIRROR_CHUNK_CELLS * BITS;
+	const Tiles* chunks = mirrorChunks().data();
+
+	Board mirror = { 0, MIRROR.cell[state.blank] };
+	Tiles tiles = state.tiles;
+	for (int chunk = 0; chunk * MIRROR_CHUNK_CELLS < CELLS; chunk++) {
+		mirror.tiles |= chunks[chunk << chunkBits | (int)(tiles & ((1 << chunkBits) - 1))];
+		tiles >>= chunkBits;
+	}
+	return mirror;
+}
+
+// the blank above the diagonal picks the state, below it the mirror, on it the smaller packed tiles
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::canonicalState(const Board& state, bool& mirrored) {
+	mirrored = false;
+	if (!SYMMETRIC || state.blank / COL < state.blank % COL) {
+		return state;
+	}
+
+	Board mirror = mirrorState(state);
+	if (state.blank / COL > state.blank % COL || mirror.tiles < state.tiles) {
+		mirrored = true;
+		return mirror;
+	}
+	return state;
+}
+
+// the canonical blank cell selects one of CANONICAL_CELLS blocks, the entry within it is the rankState() one
+template <int Rows, int Cols>
+int Puzzle<Rows, Cols>::rankCanonical(const Board& state, bool& mirrored) {
+	const int block = RANKED ? STATE_SPACE / CELLS : 1; // entries per blank cell
+	Board canonical = canonicalState(state, mirrored);
+	return MIRROR.slot[canonical.blank] * block + rankState(canonical) % block;
+}
+
+template <int Rows, int Cols>
+typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::unrankCanonical(int rank) {
+	const int block = RANKED ? STATE_SPACE / CELLS : 1;
+	return unrankState(MIRROR.slotCell[rank / block] * block + rank % block);
+}
+
+int getInvCount(int arr[], int n)
+{
+	// find inversion count of a given array
+	int inv_count = 0;
+	for (int i = 0; i < n - 1; i++)
+		for (int j = i + 1; j < n; j++)
+			// Value 0 is used for empty space
+			if (arr[j] && arr[i] && arr[i] > arr[j])
+				inv_count++;
+	return inv_count;
+}
+
+// return true if a Board can reach the goal state
+// On an odd width a vertical move passes an even number of tiles, so the
+// inversion count keeps its parity and must be even. On an even width it
+// passes an odd number, so the parity flips with every row the blank moves and
+// the inversions plus the blank's rows above the goal row must be even.
+template <int Rows, int Cols>
+bool Puzzle<Rows, Cols>::isSolvableState(const Board& state) {
+	int cells[CELLS]; // tile values w/ 0 for the empty space
+	for (int i = 0; i < CELLS; i++) {
+		cells[i] = tileAt(state, i);
+	}
+
+	int parity = getInvCount(cells, CELLS);
+	if (COL % 2 == 0) {
+		parity += ROW - 1 - state.blank / COL;
+	}
+	return parity % 2 == 0;
+}
+
+// check for goal state and return boolean status
+template <int Rows, int Cols>
+bool Puzzle<Rows, Cols>::checkGoal(const Board& state) {
+	if (state == GOALSTATE) {
+		return true;
+	}
+	else {
+		return false;
+	}
+}
+
+// count/return the number of misplaced tiles from the goal state
+template <int Rows, int Cols>
+int Puzzle<Rows, Cols>::misplacedTiles(const Board& state){
+    int tiles = 0;
+
+    // nibble-packed boards go through the SIMD kernels
+    if (BITS == 4) {
+        misplacedBatch(&state.tiles, 1, &tiles);
+        return tiles;
+    }
+
+    for(int i = 0; i < CELLS; i++){
+        // if a tile is not on its goal cell, increment tiles #
+        int tile = tileAt(state, i);
+        if(tile != 0 && tile != i + 1){
+            tiles += 1;
+        }
+    }
+    return tiles;
+}
+
+// count/return the Manhattan distance from the goal state
+template <int Rows, int Cols>
+int Puzzle<Rows, Cols>::manhattanDistance(const Board& state){
+
+    // nibble-packed boards go through the SIMD kernels
+    if (BITS == 4) {
+        int distance;
+        manhattanBatch(&state.tiles, 1, &distance);
+        return distance;
+    }
+
+    int value = 0; // puzzle tile value
+    Point temp = {0,0}; // temporary puzzle coordinates
+    Point goal = {0,0}; // goal state coordinates
+    int mDis = 0; // Manhattan distance variable
+
+    // compare the current state tiles with the goal tile locations
+    for(int i = 0; i < ROW; i++){
+        for(int j = 0; j < COL; j++){
+            value = tileAt(state, i * COL + j);
+            // the blank tile 0 does not count
+            if(value != 0){
+                temp = {i,j};
+                goal = {(value - 1) / COL, (value - 1) % COL};
+                mDis += abs(temp.x - goal.x) + abs(temp.y - goal.y);
+            }
+        }
+    }
+    return mDis;
+}
+
+// a nibble-packed board (BITS == 4) has uint64_t Tiles, which the kernels read directly
+template <int Rows, int Cols>
+void Puzzle<Rows, Cols>::misplacedBatch(const Tiles tiles[], int count, int out[]) {
+	if (BITS == 4) {
+		nibbleMisplaced(reinterpret_cast<const uint64_t*>(tiles), count, nibbleTables(), out);
+		return;
+	}
+
+	for (int b = 0; b < count; b++) {
+		Board state = { tiles[b], 0 };
+		out[b] = misplacedTiles(state);
+	}
+}
+
+template <int Rows, int Cols>
+void Puzzle<Rows, Cols>::manhattanBatch(const Tiles tiles[], int count, int out[]) {
+	if (BITS == 4) {
+		nibbleManhattan(reinterpret_cast<const uint64_t*>(tiles), count, nibbleTables(), out);
+		return;
+	}
+
+	for (int b = 0; b < count; b++) {
+		Board state = { tiles[b], 0 };
+		out[b] = manhattanDistance(state);
+	}
+}
+
+// values that are no tile (above CELLS - 1) never occur and map to nothing
+template <int Rows, int Cols>
+const vector<typename Puzzle<Rows, Cols>::Tiles>& Puzzle<Rows, Cols>::mirrorChunks() {
+	static const vector<Tiles> chunks = [] {
+		const int chunkBits = MIRROR_CHUNK_CELLS * BITS;
+		const int count = (CELLS + MIRROR_CHUNK_CELLS - 1) / MIRROR_CHUNK_CELLS;
+		vector<Tiles> table((size_t)count << chunkBits);
+		for (int chunk = 0; chunk < count; chunk++) {
+			for (int value = 0; value < (1 << chunkBits); value++) {
+				Tiles mirror = 0;
+				for (int k = 0; k < MIRROR_CHUNK_CELLS && chunk * MIRROR_CHUNK_CELLS + k < CELLS; k++) {
+					int tile = (value >> (BITS * k)) & ((1 << BITS) - 1);
+					if (tile < CELLS) {
+						mirror |= (Tiles)MIRROR.tile[tile] << (BITS * MIRROR.cell[chunk * MIRROR_CHUNK_CELLS + k]);
+					}
+				}
+				table[chunk << chunkBits | value] = mirror;
+			}
+		}
+		return table;
+	}();
+	return chunks;
+}
+
+template <int Rows, int Cols>
+const NibbleTables& Puzzle<Rows, Cols>::nibbleTables() {
+	static const NibbleTables tables = buildNibbleTables(ROW, COL);
+	return tables;
+}
+
+// the board sizes the program is built for
+template class Puzzle<3, 3>;
+template class Puzzle<4, 4>;
+template class Puzzle<5, 5>;
@@ -0,0 +1,361 @@
+/* Slider Puzzle Board
+*
+* Packed puzzle states and the tables shared by every search: the goal state,
+* the blank move table, permutation ranks and the heuristics.
+*
+* The board dimensions are template parameters. Puzzle<Rows, Cols> holds every
+* table of one board size, built at compile time from its dimensions, and the
+* functions that work on its Boards. The searches take the Puzzle as their own
+* template parameter, so each board size gets its own specialized code path.
+* Puzzle8, Puzzle15 and Puzzle24 are the 3x3, 4x4 and 5x5 boards.
+*
+* A Board keeps cellBits() bits per cell in one word, cell i in the i-th group
+* of bits, with the blank stored as tile 0 and its cell cached. Boards up to 4x4
+* pack into a uint64_t, larger ones into an unsigned __int128. Strings are only
+* used at the edges, to read, print and report states: one character per cell
+* on the 3x3 board ("12345678E"), comma-separated tiles on larger boards
+* ("1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,E"). The full Manhattan distance and
+* misplaced tiles of the nibble-packed boards (up to 4x4) run on the SIMD
+* kernels of heuristic_kernels.h.
+*
+* A square board's goal maps to itself under the reflection across the main
+* diagonal, once every tile is relabeled to the tile whose goal cell mirrors
+* its own. Every move mirrors to a move (right and down, left and up swap), so
+* a state and its mirror are the same distance from the goal. The visited
+* sets, the distance database and the solution cache store one canonical
+* state per pair: the one w/ the blank above the diagonal, or w/ the smaller
+* packed tiles when the blank is on it. Boards that are not square have no
+* mirror and every state is its own canonical state.
+*
+* File:   board.h
+*/
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "heuristic_kernels.h"
+
+// X & Y points in the puzzle 2d array
+struct Point {
+	int x;
+	int y;
+};
+
+// bits a packed cell needs to hold every tile value of a board w/ "cells" cells
+constexpr int cellBits(int cells) {
+	int bits = 1;
+	while ((1 << bits) < cells) {
+		bits++;
+	}
+	return bits;
+}
+
+// n!, for the number of states of a board
+constexpr long long factorial(int n) {
+	return n <= 1 ? 1 : n * factorial(n - 1);
+}
+
+// word holding the packed tiles of a board w/ "Cells" cells
+template <int Cells>
+using PackedTiles = typename std::conditional<Cells * cellBits(Cells) <= 64, uint64_t, unsigned __int128>::type;
+
+// packed puzzle state: cell i holds its tile in the i-th group of cellBits() bits, the blank is 0
+template <int Rows, int Cols>
+struct Board {
+	PackedTiles<Rows * Cols> tiles; // packed tile values
+	int blank; // cached empty cell index
+
+	bool operator==(const Board& other) const {
+		return tiles == other.tiles;
+	}
+
+	bool operator!=(const Board& other) const {
+		return tiles != other.tiles;
+	}
+};
+
+// blank moves in the order children are generated, 2-bit codes (opposite = code ^ 2)
+enum Move { RIGHT = 0, DOWN = 1, LEFT = 2, UP = 3 };
+
+// the Move that mirrors a Move across the main diagonal (right and down, left and up swap)
+inline int mirrorMove(int move) {
+	return move ^ 1;
+}
+
+// neighbor table indexed by blank cell and Move: the cell the blank slides to, -1 if off the board
+template <int Cells>
+struct MoveTable {
+	int to[Cells][4];
+
+	constexpr const int* operator[](int cell) const {
+		return to[cell];
+	}
+};
+
+// heuristic change when a tile slides between two cells, indexed [tile][from][to]
+// Only one tile moves per step, so a child's heuristic is its parent's plus one entry.
+template <int Cells>
+struct HeuristicDeltas {
+	int8_t delta[Cells][Cells][Cells];
+};
+
+// build the neighbor table of a Rows x Cols board
+template <int Rows, int Cols>
+constexpr MoveTable<Rows * Cols> buildMoveTable() {
+	MoveTable<Rows * Cols> table = {};
+	for (int cell = 0; cell < Rows * Cols; cell++) {
+		int row = cell / Cols;
+		int col = cell % Cols;
+		table.to[cell][RIGHT] = col + 1 < Cols ? cell + 1 : -1;
+		table.to[cell][DOWN] = row + 1 < Rows ? cell + Cols : -1;
+		table.to[cell][LEFT] = col > 0 ? cell - 1 : -1;
+		table.to[cell][UP] = row > 0 ? cell - Cols : -1;
+	}
+	return table;
+}
+
+// reflection of a board across its main diagonal, and the cells a canonical state may have its blank on
+template <int Cells>
+struct MirrorTable {
+	int cell[Cells]; // cell (r, c) mirrors to (c, r)
+
+	int tile[Cells]; // tile t mirrors to the tile whose goal cell mirrors t's, the blank stays 0
+
+	int slot[Cells]; // index of a cell among the cells on or above the diagonal, -1 below it
+
+	int slotCell[Cells]; // cell of each slot
+};
+
+// build the mirror table of a Rows x Cols board, the identity unless the board is square
+template <int Rows, int Cols>
+constexpr MirrorTable<Rows * Cols> buildMirrorTable() {
+	MirrorTable<Rows * Cols> table = {};
+	int slots = 0;
+	for (int cell = 0; cell < Rows * Cols; cell++) {
+		int row = cell / Cols;
+		int col = cell % Cols;
+		table.cell[cell] = Rows == Cols ? col * Cols + row : cell;
+		table.tile[cell] = cell == 0 ? 0 : table.cell[cell - 1] + 1;
+		table.slot[cell] = Rows != Cols || row <= col ? slots : -1;
+		if (table.slot[cell] >= 0) {
+			table.slotCell[slots] = cell;
+			slots++;
+		}
+	}
+	return table;
+}
+
+// build the goal state of a Rows x Cols board: tiles 1 to n in order, the blank on the last cell
+template <int Rows, int Cols>
+constexpr Board<Rows, Cols> buildGoalState() {
+	Board<Rows, Cols> goal = {};
+	for (int cell = 0; cell < Rows * Cols - 1; cell++) {
+		goal.tiles |= (PackedTiles<Rows * Cols>)(cell + 1) << (cellBits(Rows * Cols) * cell);
+	}
+	goal.blank = Rows * Cols - 1;
+	return goal;
+}
+
+// build the delta tables of the Manhattan distance (manhattan = true) or misplaced tiles heuristic
+template <int Rows, int Cols>
+constexpr HeuristicDeltas<Rows * Cols> buildHeuristicDeltas(bool manhattan) {
+	HeuristicDeltas<Rows * Cols> deltas = {};
+	for (int tile = 1; tile < Rows * Cols; tile++) {
+		int goal = tile - 1; // goal cell of the tile
+
+		// cost of the tile standing on each cell
+		int cost[Rows * Cols] = {};
+		for (int cell = 0; cell < Rows * Cols; cell++) {
+			if (manhattan) {
+				int rows = cell / Cols - goal / Cols;
+				int cols = cell % Cols - goal % Cols;
+				cost[cell] = (rows < 0 ? -rows : rows) + (cols < 0 ? -cols : cols);
+			}
+			else {
+				cost[cell] = cell != goal ? 1 : 0;
+			}
+		}
+
+		for (int from = 0; from < Rows * Cols; from++) {
+			for (int to = 0; to < Rows * Cols; to++) {
+				deltas.delta[tile][from][to] = (int8_t)(cost[to] - cost[from]);
+			}
+		}
+	}
+	return deltas;
+}
+
+// copied from http://www.geeksforgeeks.org/check-instance-8-puzzle-solvable/
+// find inversion count of a given array of n cells
+int getInvCount(int arr[], int n);
+
+// one board size: its tables and the functions on its Boards
+template <int Rows, int Cols>
+class Puzzle {
+public:
+
+	// packed state of this board size
+	typedef ::Board<Rows, Cols> Board;
+
+	// word holding the packed tiles
+	typedef PackedTiles<Rows * Cols> Tiles;
+
+	static constexpr int ROW = Rows; // number of rows
+	static constexpr int COL = Cols; // number of columns
+	static constexpr int CELLS = Rows * Cols; // number of cells, the blank included
+
+	// bits per packed cell
+	static constexpr int BITS = cellBits(Rows * Cols);
+
+	// true if every state has a dense rank (rankState) small enough to index a table
+	static constexpr bool RANKED = Rows * Cols <= 9;
+
+	// number of states reachable from any start (cells * (cells - 1)!/2), 0 unless RANKED
+	static constexpr int STATE_SPACE = RANKED ? (int)(factorial(Rows * Cols) / 2) : 0;
+
+	// true if the board mirrors across its main diagonal
+	static constexpr bool SYMMETRIC = Rows == Cols;
+
+	// cells a canonical state may have its blank on
+	static constexpr int CANONICAL_CELLS = SYMMETRIC ? Rows * (Rows + 1) / 2 : CELLS;
+
+	// number of canonical ranks (rankCanonical), 0 unless RANKED
+	static constexpr int CANONICAL_SPACE = RANKED ? CANONICAL_CELLS * (STATE_SPACE / CELLS) : 0;
+
+	// reflection across the main diagonal, built at compile time
+	static constexpr MirrorTable<Rows * Cols> MIRROR = buildMirrorTable<Rows, Cols>();
+
+	// neighbor table indexed by blank cell and Move, built at compile time
+	static constexpr MoveTable<Rows * Cols> NEIGHBORS = buildMoveTable<Rows, Cols>();
+
+	// constant goal state of puzzle, built at compile time
+	static constexpr Board GOALSTATE = buildGoalState<Rows, Cols>();
+
+	// Manhattan distance deltas indexed [tile][from][to], built at compile time
+	static constexpr HeuristicDeltas<Rows * Cols> manhattanDeltas = buildHeuristicDeltas<Rows, Cols>(true);
+
+	// misplaced tiles deltas indexed [tile][from][to], built at compile time
+	static constexpr HeuristicDeltas<Rows * Cols> misplacedDeltas = buildHeuristicDeltas<Rows, Cols>(false);
+
+	// change of the Manhattan distance when "tile" slides from cell "from" to cell "to"
+	static int manhattanDelta(int tile, int from, int to) {
+		return manhattanDeltas.delta[tile][from][to];
+	}
+
+	// change of the misplaced tiles count when "tile" slides from cell "from" to cell "to"
+	static int misplacedDelta(int tile, int from, int to) {
+		return misplacedDeltas.delta[tile][from][to];
+	}
+
+	// goal state of puzzle in string form
+	static std::string goalString();
+
+	// path label ("1 to 2,") of a blank Move from a cell
+	static std::string moveLabel(int cell, int move);
+
+	// pack a string state into a Board
+	static Board packState(const std::string& state);
+
+	// unpack a Board into a string state
+	static std::string unpackState(const Board& board);
+
+	// return true if a string is a start state: every tile and 'E' exactly once each
+	static bool validState(const std::string& state);
+
+	// return the tile value held by a cell of a Board
+	static int tileAt(const Board& board, int cell);
+
+	// write the cell of every tile value, where[0] is the blank cell
+	static void tileCells(const Board& board, int where[]);
+
+	// print a Board as a 2D puzzle
+	static void printPuzzle(const Board& state);
+
+	// slide the tile on cell "to" into the blank cell of a state
+	static Board slideBlank(const Board& state, int to);
+
+	// rank a state to a dense index in [0, STATE_SPACE), RANKED boards only
+	static int rankState(const Board& state);
+
+	// the solvable state of a rank in [0, STATE_SPACE), RANKED boards only
+	static Board unrankState(int rank);
+
+	// reflect a state across the main diagonal and relabel its tiles, the goal state maps to itself
+	static Board mirrorState(const Board& state);
+
+	// the canonical state of a state and its mirror, "mirrored" set if it is the mirror
+	static Board canonicalState(const Board& state, bool& mirrored);
+
+	// rank the canonical state of a state to a dense index in [0, CANONICAL_SPACE), RANKED boards only
+	// Only the rows of the blank cells on or above the diagonal are kept, so a
+	// canonical rank table takes (n + 1)/2n of a full one.
+	static int rankCanonical(const Board& state, bool& mirrored);
+
+	// the canonical state of a canonical rank, RANKED boards only
+	// Ranks of non-canonical states w/ the blank on the diagonal are never
+	// returned by rankCanonical() and give that state.
+	static Board unrankCanonical(int rank);
+
+	// return true if a Board can reach the goal state
+	static bool isSolvableState(const Board& state);
+
+	// check for goal state
+	static bool checkGoal(const Board& workingState);
+
+	// count/return the number of misplaced tiles from the goal state
+	static int misplacedTiles(const Board& state);
+
+	// count/return the Manhattan distance from the goal state
+	static int manhattanDistance(const Board& state);
+
+	// write the number of misplaced tiles of "count" packed boards, w/ the SIMD kernels on nibble-packed boards
+	static void misplacedBatch(const Tiles tiles[], int count, int out[]);
+
+	// write the Manhattan distance of "count" packed boards, w/ the SIMD kernels on nibble-packed boards
+	static void manhattanBatch(const Tiles tiles[], int count, int out[]);
+
+private:
+
+	// goal and cell tables of the SIMD kernels (heuristic_kernels.h), nibble-packed boards only
+	static const NibbleTables& nibbleTables();
+
+	// cells mirrorState() looks up at once, as many as fit a byte
+	static constexpr int MIRROR_CHUNK_CELLS = BITS < 8 ? 8 / BITS : 1;
+
+	// mirrored tiles of every value of every chunk of cells, indexed [chunk << (MIRROR_CHUNK_CELLS * BITS) | value]
+	static const std::vector<Tiles>& mirrorChunks();
+
+	// read the tile of every cell of a string state (0 for 'E'), return false unless each appears exactly once
+	static bool readCells(const std::string& state, int cells[]);
+};
+
+template <int Rows, int Cols>
+constexpr MoveTable<Rows * Cols> Puzzle<Rows, Cols>::NEIGHBORS;
+
+template <int Rows, int Cols>
+constexpr typename Puzzle<Rows, Cols>::Board Puzzle<Rows, Cols>::GOALSTATE;
+
+template <int Rows, int Cols>
+constexpr HeuristicDeltas<Rows * Cols> Puzzle<Rows, Cols>::manhattanDeltas;
+
+template <int Rows, int Cols>
+constexpr HeuristicDeltas<Rows * Cols> Puzzle<Rows, Cols>::misplacedDeltas;
+
+template <int Rows, int Cols>
+constexpr MirrorTable<Rows * Cols> Puzzle<Rows, Cols>::MIRROR;
+
+// the 3x3 board (8-puzzle)
+typedef Puzzle<3, 3> Puzzle8;
+
+// the 4x4 board (15-puzzle)
+typedef Puzzle<4, 4> Puzzle15;
+
+// the 5x5 board (24-puzzle)
+typedef Puzzle<5, 5> Puzzle24;
+
+#endif
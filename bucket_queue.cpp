@@ -0,0 +1,92 @@
+/* Slider Puzzle Bucket Queue
+*
+* See bucket_queue.h.
+*
+* File:   bucket_queue.cpp
+*/
+
+#include "bucket_queue.h"
+
+#include <cassert>
+
+using namespace std;
+
+bool BucketQueue::empty() const {
+	return count == 0;
+}
+
+void BucketQueue::push(int node, int f, int g) {
+
+	// grow the bucket rows the first time an f value is seen
+	if (f >= (int)buckets.size()) {
+		buckets.resize(f + 1);
+		occupied.resize(f + 1);
+	}
+	if (g >= (int)buckets[f].size()) {
+		buckets[f].resize(g + 1);
+		occupied[f].resize(g / 64 + 1);
+	}
+
+	buckets[f][g].push_back(node);
+	occupied[f][g / 64] |= 1ULL << (g % 64);
+	count++;
+
+	// an inconsistent heuristic may push below the scan start
+	if (f < minF) {
+		minF = f;
+	}
+}
+
+int BucketQueue::pop() {
+	assert(count > 0);
+
+	// lowest f with a queued index
+	while (true) {
+		vector<uint64_t>& words = occupied[minF];
+
+		// highest g first, last pushed first
+		for (int w = (int)words.size() - 1; w >= 0; w--) {
+			if (words[w] != 0) {
+				int g = w * 64 + 63 - __builtin_clzll(words[w]);
+				vector<int>& bucket = buckets[minF][g];
+				int node = bucket.back();
+				bucket.pop_back();
+				if (bucket.empty()) {
+					words[w] &= ~(1ULL << (g % 64));
+				}
+				count--;
+				return node;
+			}
+		}
+		minF++;
+	}
+}
+
+void BucketQueue::clear() {
+	for (unsigned int f = 0; f < buckets.size(); f++) {
+		for (unsigned int g = 0; g < buckets[f].size(); g++) {
+			buckets[f][g].clear();
+		}
+		for (unsigned int w = 0; w < occupied[f].size(); w++) {
+			occupied[f][w] = 0;
+		}
+	}
+	count = 0;
+	minF = 0;
+}
+
+size_t BucketQueue::size() const {
+	return count;
+}
+
+size_t BucketQueue::bytes() const {
+	size_t total = buckets.capacity() * sizeof(buckets[0]);
+	for (unsigned int f = 0; f < buckets.size(); f++) {
+		total += buckets[f].capacity() * sizeof(buckets[f][0]);
+		for (unsigned int g = 0; g < buckets[f].size(); g++) {
+			total += buckets[f][g].capacity() * sizeof(int);
+		}
+		total += occupied[f].capacity() * sizeof(uint64_t);
+	}
+	return total;
+}
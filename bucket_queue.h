@@ -0,0 +1,60 @@
+/* Slider Puzzle Bucket Queue
+*
+* Open list for the A* searches. Every move costs 1 and the heuristics are
+* small integers, so f(n) and g(n) only take a few dozen values. Node indices
+* are kept in one LIFO bucket per (f, g) pair: push appends to a bucket and pop
+* takes the last index of the lowest f, highest g bucket. Preferring the larger
+* g among equal f values reaches the goal sooner, and LIFO keeps the most
+* recently generated (cache-warm) node first.
+*
+* With a consistent heuristic the smallest f never decreases, so the pop scan
+* starts where the last one stopped. Each f row keeps a bitmask of its
+* non-empty g buckets, so pop finds the highest g w/ a count-leading-zeros
+* instead of a scan down the row, and both operations are O(1) amortized.
+*
+* File:   bucket_queue.h
+*/
+
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// monotone priority queue of node indices keyed by (f, g)
+class BucketQueue {
+public:
+
+	// return true if no index is queued
+	bool empty() const;
+
+	// queue a node index with its f(n) and g(n) values (g <= f)
+	void push(int node, int f, int g);
+
+	// remove and return the index with the lowest f, highest g, queued last (the queue must not be empty)
+	int pop();
+
+	// empty every bucket, the buckets keep their capacity
+	void clear();
+
+	// number of queued indices
+	size_t size() const;
+
+	// bytes held by the buckets
+	size_t bytes() const;
+
+private:
+
+	// node indices indexed [f][g]
+	std::vector<std::vector<std::vector<int> > > buckets;
+
+	// bit g % 64 of word g / 64 of row f is set while bucket [f][g] holds an index
+	std::vector<std::vector<uint64_t> > occupied;
+
+	size_t count = 0; // number of queued indices
+
+	int minF = 0; // no bucket below this f holds an index
+};
+
+#endif
@@ -0,0 +1,114 @@
+/* Slider Puzzle Distance Database
+*
+* Building and mapping the distance database. See distance_db.h.
+*
+* File:   distance_db.cpp
+*/
+
+#include "distance_db.h"
+#include "level_bfs.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+// the only board size w/ a distance database
+typedef Puzzle8 P;
+
+// distance database file name
+const string DATABASE_FILE = "distances.db";
+
+bool DistanceDatabase::build(const string& fileName) {
+
+	// every canonical state's distance, claimed level by level on all cores
+	bool mirrored;
+	LevelBfs bfs(P::CANONICAL_SPACE, 0);
+	vector<uint8_t> distance = bfs.run({ (uint32_t)P::rankCanonical(P::GOALSTATE, mirrored) },
+		[](uint32_t rank, uint32_t child[], int cost[]) {
+			P::Board state = P::unrankCanonical(rank);
+			bool mirrored;
+			int count = 0;
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[state.blank][move];
+				if (to >= 0) {
+					child[count] = P::rankCanonical(P::slideBlank(state, to), mirrored);
+					cost[count] = 1;
+					count++;
+				}
+			}
+			return count;
+		});
+
+	// the best move of each state leads to a state one move closer, the goal keeps move 0
+	vector<uint8_t> table(distance);
+	bfs.parallel([&](int w) {
+		int begin = (int)((long long)P::CANONICAL_SPACE * w / bfs.workers()); // each worker takes one block of ranks
+		int end = (int)((long long)P::CANONICAL_SPACE * (w + 1) / bfs.workers());
+		bool mirrored;
+		for (int rank = begin; rank < end; rank++) {
+			if (distance[rank] == 0 || distance[rank] == 0xFF) {
+				continue;
+			}
+
+			P::Board state = P::unrankCanonical(rank);
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[state.blank][move];
+				if (to >= 0 && distance[P::rankCanonical(P::slideBlank(state, to), mirrored)] == distance[rank] - 1) {
+					table[rank] = (uint8_t)(distance[rank] | (move << 6));
+					break;
+				}
+			}
+		}
+	});
+
+	DatabaseHeader header = { { 'S', 'P', 'D', 'B' }, DATABASE_VERSION, P::ROW, P::COL, P::CANONICAL_SPACE };
+
+	ofstream database(fileName.c_str(), ios::binary | ios::trunc);
+	database.write((const char*)&header, sizeof(header));
+	database.write((const char*)table.data(), table.size());
+	return (bool)database;
+}
+
+bool DistanceDatabase::open(const string& fileName) {
+
+	close();
+
+	if (!file.open(fileName)) {
+		return false;
+	}
+
+	// reject files from another version or board size
+	const DatabaseHeader* header = (const DatabaseHeader*)file.data();
+	if (file.size() != sizeof(DatabaseHeader) + P::CANONICAL_SPACE
+		|| memcmp(header->magic, "SPDB", 4) != 0 || header->version != DATABASE_VERSION
+		|| header->rows != P::ROW || header->cols != P::COL || header->entries != P::CANONICAL_SPACE) {
+		close();
+		return false;
+	}
+
+	entries = file.data() + sizeof(DatabaseHeader);
+	return true;
+}
+
+void DistanceDatabase::close() {
+	file.close();
+	entries = NULL;
+}
+
+bool DistanceDatabase::isOpen() const {
+	return entries != NULL;
+}
+
+int DistanceDatabase::distance(const P::Board& state) const {
+	bool mirrored;
+	return entries[P::rankCanonical(state, mirrored)] & 0x3F;
+}
+
+// the stored move is the canonical state's, a mirrored state takes the mirrored move
+int DistanceDatabase::bestMove(const P::Board& state) const {
+	bool mirrored;
+	int move = entries[P::rankCanonical(state, mirrored)] >> 6;
+	return mirrored ? mirrorMove(move) : move;
+}
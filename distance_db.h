@@ -0,0 +1,73 @@
+/* Slider Puzzle Distance Database
+*
+* One retrograde BFS from the goal state gives every solvable state's optimal
+* distance and the best blank move toward the goal. The BFS runs level by level
+* on all cores (level_bfs.h), then each state picks a move to a state one move
+* closer. Both run on canonical states only (board.h), a state's mirror is as
+* far from the goal and its best move is the mirrored one. The table is indexed
+* by rankCanonical() and written to a versioned binary file. Later runs map the
+* file read-only, so solver processes on the same host share one page-cached
+* copy.
+*
+* File format: a DatabaseHeader followed by CANONICAL_SPACE one-byte entries.
+* Each entry holds the distance in bits 0-5 and the best Move of the canonical
+* state in bits 6-7. Ranks no canonical state takes hold 0xFF.
+*
+* Only the 3x3 board (Puzzle8) has a database, larger boards have far too many
+* states to store.
+*
+* File:   distance_db.h
+*/
+
+#ifndef DISTANCE_DB_H
+#define DISTANCE_DB_H
+
+#include <cstdint>
+#include <string>
+
+#include "board.h"
+#include "mapped_file.h"
+
+// distance database file and format version
+extern const std::string DATABASE_FILE;
+#define DATABASE_VERSION 2
+
+// header written in front of the distance database entries
+struct DatabaseHeader {
+	char magic[4]; // "SPDB"
+	uint32_t version; // DATABASE_VERSION
+	uint32_t rows; // board rows
+	uint32_t cols; // board columns
+	uint32_t entries; // number of ranked entries that follow (Puzzle8::CANONICAL_SPACE)
+};
+
+// read-only view of a distance database file
+class DistanceDatabase {
+public:
+
+	// parallel retrograde BFS from the goal state, write every state's distance and best move to a file
+	static bool build(const std::string& fileName);
+
+	// memory-map a distance database file read-only, replacing any open one
+	bool open(const std::string& fileName);
+
+	// release the mapping
+	void close();
+
+	// return true once a database file is mapped
+	bool isOpen() const;
+
+	// optimal number of moves from a solvable state to the goal
+	int distance(const Puzzle8::Board& state) const;
+
+	// Move of the blank that starts an optimal path from a solvable state
+	int bestMove(const Puzzle8::Board& state) const;
+
+private:
+
+	MappedFile file; // the mapped database file
+
+	const uint8_t* entries = NULL; // first entry, just after the header, NULL when closed
+};
+
+#endif
@@ -0,0 +1,295 @@
+/* Slider Puzzle HDA*
+*
+* Hash-distributed parallel A* workers. See hda.h.
+*
+* File:   hda.cpp
+*/
+
+#include "hda.h"
+#include "heuristics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+using namespace std;
+
+template <class P>
+bool HdaSearch<P>::run(const Board& start, int threads, vector<int>& moves) {
+
+	if (threads < 1) {
+		threads = (int)thread::hardware_concurrency(); // one worker per core by default
+	}
+	if (threads < 1) {
+		threads = 1;
+	}
+
+	// keep the workers of the last search when the count matches, they keep their capacity
+	if ((int)workers.size() != threads) {
+		workers.clear();
+		for (int w = 0; w < threads; w++) {
+			workers.push_back(unique_ptr<Worker>(new Worker()));
+		}
+	}
+	for (int w = 0; w < threads; w++) {
+		Worker& worker = *workers[w];
+		worker.inbox.clear();
+		worker.pool.rewind();
+		worker.open.clear();
+		worker.closed.clear();
+		worker.stats = SearchStats();
+		worker.outbox.resize(threads);
+		for (int to = 0; to < threads; to++) {
+			worker.outbox[to].clear();
+		}
+	}
+
+	bestCost = INT_MAX;
+	bestWorker = -1;
+	bestIndex = -1;
+
+	// every worker starts busy and goes idle once it runs dry
+	pending = threads;
+
+	// the root goes straight to its owner
+	Node root = { start, 0, ManhattanPolicy<P>().evaluate(start), -1, -1, -1 };
+	receive(owner(start), root);
+
+	vector<thread> pool;
+	for (int w = 1; w < threads; w++) {
+		pool.push_back(thread(&HdaSearch::work, this, w));
+	}
+	work(0); // the calling thread is worker 0
+	for (unsigned int t = 0; t < pool.size(); t++) {
+		pool[t].join();
+	}
+
+	// the closed sets only grow, so their final sizes add up to the peak, and the storage is held by every worker at once
+	// The open peak is the sum of the per-worker peaks, which need not fall at the same time.
+	totals = SearchStats();
+	long long peakOpen = 0;
+	long long peakVisited = 0;
+	for (int w = 0; w < threads; w++) {
+		Worker& worker = *workers[w];
+		worker.stats.bytes = worker.pool.bytes() + worker.open.bytes() + worker.closed.bytes();
+		totals.merge(worker.stats);
+		peakOpen += worker.stats.peakOpen;
+		peakVisited += worker.closed.size();
+	}
+	totals.peakOpen = peakOpen;
+	totals.peakVisited = peakVisited;
+
+	if (bestWorker < 0) {
+		return false;
+	}
+
+	// walk the parent links back to the root, across the workers' pools
+	moves.clear();
+	for (const Node* node = &workers[bestWorker]->pool[bestIndex]; node->parentWorker >= 0;
+		node = &workers[node->parentWorker]->pool[node->parent]) {
+		moves.push_back(node->move);
+	}
+	reverse(moves.begin(), moves.end());
+	return true;
+}
+
+template <class P>
+int HdaSearch<P>::nodes() const {
+	return (int)totals.generated;
+}
+
+template <class P>
+const SearchStats& HdaSearch<P>::stats() const {
+	return totals;
+}
+
+template <class P>
+void HdaSearch<P>::work(int self) {
+	Worker& me = *workers[self];
+	ManhattanPolicy<P> heuristic;
+
+	bool busy = true; // counted in "pending"
+	int idle = 0; // inbox checks since this worker last had a node
+	int expansions = 0; // since the last flush of every buffer
+	long long cpuStart = threadCpuMicros(); // the calling thread's time is charged by the Solver
+
+	while (true) {
+
+		// take in the nodes other workers sent, each was counted as pending by its sender
+		typename MpscQueue<Node>::Batch* batch = me.inbox.takeAll();
+		if (batch != NULL) {
+			idle = 0;
+			if (!busy) {
+				pending++; // busy again before the sent nodes stop counting
+				busy = true;
+			}
+		}
+		while (batch != NULL) {
+			for (unsigned int i = 0; i < batch->items.size(); i++) {
+				receive(self, batch->items[i]);
+			}
+			pending -= batch->items.size();
+
+			typename MpscQueue<Node>::Batch* next = batch->next;
+			delete batch;
+			batch = next;
+		}
+
+		if (!me.open.empty()) {
+			int index = me.open.pop(); // cheapest owned node
+			Node node = me.pool[index];
+
+			// nothing left in this open list can beat the best path found
+			if (node.g + node.h >= bestCost.load(memory_order_relaxed)) {
+				me.open.clear();
+				continue;
+			}
+
+			// a shorter path to this state was queued after this node, the node is stale
+			if (node.g > me.closed.depth(node.state)) {
+				continue;
+			}
+			me.stats.expanded++;
+
+			// generate children through the move table
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[node.state.blank][move];
+
+				// the blank cannot leave the board, and undoing the parent move leads back to a closed state
+				if (to < 0 || move == (node.move ^ 2)) {
+					continue;
+				}
+
+				Node child;
+				child.state = P::slideBlank(node.state, to);
+				child.g = node.g + 1;
+				child.h = heuristic.update(node.h, child.state, P::tileAt(child.state, node.state.blank),
+					to, node.state.blank);
+				child.parentWorker = self;
+				child.parent = index;
+				child.move = move;
+				me.stats.generated++;
+
+				// prune before paying for a message
+				if (child.g + child.h >= bestCost.load(memory_order_relaxed)) {
+					continue;
+				}
+
+				// a goal is never expanded, so it lowers the incumbent right here instead of at its owner
+				if (P::checkGoal(child.state)) {
+					improveBest(self, child);
+					continue;
+				}
+
+				int dest = owner(child.state);
+				if (dest == self) {
+					receive(self, child);
+				}
+				else {
+					me.outbox[dest].push_back(child);
+					if (me.outbox[dest].size() >= HDA_BATCH) {
+						flush(self, dest);
+					}
+				}
+			}
+
+			// keep the other workers fed w/ partly filled buffers too
+			if (++expansions >= HDA_FLUSH_INTERVAL) {
+				for (int to = 0; to < (int)workers.size(); to++) {
+					flush(self, to);
+				}
+				expansions = 0;
+			}
+			continue;
+		}
+
+		// out of local work: send everything buffered, then wait for nodes or the end of the search
+		for (int to = 0; to < (int)workers.size(); to++) {
+			flush(self, to);
+		}
+		if (busy) {
+			busy = false;
+			pending--;
+		}
+
+		// no busy worker and no node in flight, nothing can make new work
+		if (pending.load() == 0) {
+			if (self != 0) {
+				me.stats.cpuMicros[SEARCH] += threadCpuMicros() - cpuStart;
+			}
+			return;
+		}
+
+		// back off: spin, then yield, then sleep
+		idle++;
+		if (idle > HDA_IDLE_YIELDS) {
+			this_thread::sleep_for(chrono::microseconds(HDA_IDLE_SLEEP));
+		}
+		else if (idle > HDA_IDLE_SPINS) {
+			this_thread::yield();
+		}
+	}
+}
+
+template <class P>
+void HdaSearch<P>::receive(int self, const Node& node) {
+	Worker& me = *workers[self];
+
+	// no path through this node can beat the best one found
+	if (node.g + node.h >= bestCost.load(memory_order_relaxed)) {
+		return;
+	}
+
+	// skip the node if its state was already reached in as few moves, states close on expansion
+	if (!me.closed.improve(node.state, node.g)) {
+		me.stats.duplicates++;
+		return;
+	}
+
+	me.pool.push_back(node);
+	me.open.push(me.pool.size() - 1, node.g + node.h, node.g);
+	SearchStats::raise(me.stats.peakOpen, me.open.size());
+}
+
+template <class P>
+void HdaSearch<P>::improveBest(int self, const Node& goal) {
+	lock_guard<mutex> guard(bestLock);
+	if (goal.g >= bestCost.load()) {
+		return;
+	}
+
+	// the goal node stays in the pool of the worker that generated it, for the path walk
+	workers[self]->pool.push_back(goal);
+	bestCost = goal.g;
+	bestWorker = self;
+	bestIndex = workers[self]->pool.size() - 1;
+}
+
+template <class P>
+void HdaSearch<P>::flush(int self, int to) {
+	vector<Node>& buffer = workers[self]->outbox[to];
+	if (buffer.empty()) {
+		return;
+	}
+
+	typename MpscQueue<Node>::Batch* batch = new typename MpscQueue<Node>::Batch();
+	batch->items.swap(buffer);
+	buffer.reserve(HDA_BATCH);
+
+	// counted before it can be received, so "pending" never drops to 0 while it is in flight
+	pending += batch->items.size();
+	workers[to]->inbox.push(batch);
+}
+
+// the high half of the tiles hash, the closed sets' hash maps bucket by the low half
+template <class P>
+int HdaSearch<P>::owner(const Board& state) const {
+	bool mirrored;
+	return (int)((TilesHash()(P::canonicalState(state, mirrored).tiles) >> 32) % workers.size());
+}
+
+// the board sizes the program is built for
+template class HdaSearch<Puzzle8>;
+template class HdaSearch<Puzzle15>;
+template class HdaSearch<Puzzle24>;
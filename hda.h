@@ -0,0 +1,141 @@
+/* Slider Puzzle HDA*
+*
+* Hash-distributed A* (HDA*): one A* search with the Manhattan distance spread
+* over several worker threads. Every state has an owner worker, picked by a hash
+* of its packed tiles, and only the owner keeps it in its open list and closed
+* set, so the workers share no search structures. A worker that generates a
+* child owned by another worker buffers it and sends it in a batch through the
+* owner's lock-free inbox (mpsc_queue.h).
+*
+* The first goal reached is not necessarily an optimal one, since the workers
+* expand in different f orders. A generated goal only sets the incumbent (best
+* path cost found so far), and every node with f >= the incumbent is dropped
+* from then on. The search ends when no worker has a node left and no batch is
+* in flight, which one shared counter tracks: busy workers plus sent but
+* unprocessed nodes. Once it reads 0 nothing can make new work, so every node
+* under the incumbent was expanded and the incumbent is optimal. A worker
+* waiting for nodes backs off: it spins, then yields, then sleeps briefly
+* between checks, so idle workers leave the cores to the busy ones.
+*
+* File:   hda.h
+*/
+
+#ifndef HDA_H
+#define HDA_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arena.h"
+#include "board.h"
+#include "bucket_queue.h"
+#include "mpsc_queue.h"
+#include "search_stats.h"
+#include "state_set.h"
+
+// nodes buffered for one worker before they are sent
+#define HDA_BATCH 64
+
+// expansions between flushes of every partly filled buffer
+#define HDA_FLUSH_INTERVAL 256
+
+// idle rounds a worker spins, then yields, before it sleeps between inbox checks
+#define HDA_IDLE_SPINS 64
+#define HDA_IDLE_YIELDS 256
+
+// sleep between inbox checks of a worker idle past the spins and yields, in microseconds
+#define HDA_IDLE_SLEEP 50
+
+// search node of an HDA* worker, also the message sent to the owner of its state
+template <class P>
+struct HdaNode {
+
+	typename P::Board state; // state of the puzzle
+
+	int g; // moves from the start state
+
+	int h; // Manhattan distance, updated from the parent's per move
+
+	int parentWorker; // worker holding the parent node, -1 for the root
+
+	int parent; // index of the parent node in that worker's pool
+
+	int move; // Move code that produced this node from its parent
+};
+
+// hash-distributed parallel A* w/ the Manhattan distance, reused between searches
+template <class P>
+class HdaSearch {
+public:
+
+	// packed state of the board size
+	typedef typename P::Board Board;
+
+	// search from a (solvable) start state on "threads" workers, 0 for one per core
+	// Write the moves of an optimal path and return true, or return false if the goal was not reached.
+	bool run(const Board& start, int threads, std::vector<int>& moves);
+
+	// number of nodes the last search generated, the root not included
+	int nodes() const;
+
+	// counters of the last search over every worker, and the CPU time of the workers but the calling thread
+	const SearchStats& stats() const;
+
+private:
+
+	typedef HdaNode<P> Node;
+
+	// one worker's search structures, touched by its own thread only (but for the inbox)
+	struct Worker {
+		MpscQueue<Node> inbox; // nodes sent by other workers
+
+		Arena<Node> pool; // every node this worker owns, open lists hold indices into it
+
+		BucketQueue open; // open list of pool indices, bucketed by f(n) and g(n)
+
+		StateSet<P> closed; // owned states and the shortest depth found to each
+
+		std::vector<std::vector<Node> > outbox; // nodes buffered for each other worker
+
+		SearchStats stats; // this worker's counters
+	};
+
+	// worker thread body: take in sent nodes, expand the cheapest open node, until the search ends
+	void work(int self);
+
+	// store a node in its owner's pool and open list, unless it is pruned or was reached as cheaply
+	void receive(int self, const Node& node);
+
+	// make a goal node generated by a worker the incumbent if it is cheaper than the best path so far
+	// The search goes on until no cheaper node is left.
+	void improveBest(int self, const Node& goal);
+
+	// send the nodes buffered for one worker
+	void flush(int self, int to);
+
+	// worker that owns a state
+	int owner(const Board& state) const;
+
+	// the workers, heap allocated since each holds atomics
+	std::vector<std::unique_ptr<Worker> > workers;
+
+	// busy workers plus sent nodes not processed yet, the search is over at 0
+	std::atomic<long long> pending{ 0 };
+
+	// cost of the best path found so far, INT_MAX before the first
+	std::atomic<int> bestCost{ 0 };
+
+	// guards the best goal node
+	std::mutex bestLock;
+
+	// worker and pool index of the best goal node, -1 before the first
+	int bestWorker = -1;
+	int bestIndex = -1;
+
+	// every worker's counters, merged once the search ends
+	SearchStats totals;
+};
+
+#endif
@@ -0,0 +1,207 @@
+/* Slider Puzzle Heuristic Kernels
+*
+* Scalar, SSSE3 and AVX2 kernels and the run time dispatch. See
+* heuristic_kernels.h.
+*
+* File:   heuristic_kernels.cpp
+*/
+
+#include "heuristic_kernels.h"
+
+#include <cstdlib>
+
+// _mm_cvtsi64_si128 needs a 64-bit target
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define HEURISTIC_KERNELS_X86 1
+#endif
+
+using namespace std;
+
+NibbleTables buildNibbleTables(int rows, int cols) {
+	NibbleTables tables = {};
+	for (int tile = 1; tile < rows * cols; tile++) {
+		tables.goalRow[tile] = (int8_t)((tile - 1) / cols);
+		tables.goalCol[tile] = (int8_t)((tile - 1) % cols);
+	}
+	for (int cell = 0; cell < rows * cols; cell++) {
+		tables.cellRow[cell] = (int8_t)(cell / cols);
+		tables.cellCol[cell] = (int8_t)(cell % cols);
+		tables.goalTile[cell] = (int8_t)(cell + 1 < rows * cols ? cell + 1 : 0);
+	}
+	return tables;
+}
+
+// one board at a time, one nibble at a time
+static void scalarManhattan(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	for (int b = 0; b < count; b++) {
+		int distance = 0;
+		for (int cell = 0; cell < 16; cell++) {
+			int tile = (int)((tiles[b] >> (4 * cell)) & 0xF);
+
+			// the blank and the unused nibbles past the last cell hold 0
+			if (tile != 0) {
+				distance += abs(tables.goalRow[tile] - tables.cellRow[cell]) + abs(tables.goalCol[tile] - tables.cellCol[cell]);
+			}
+		}
+		out[b] = distance;
+	}
+}
+
+static void scalarMisplaced(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	for (int b = 0; b < count; b++) {
+		int misplaced = 0;
+		for (int cell = 0; cell < 16; cell++) {
+			int tile = (int)((tiles[b] >> (4 * cell)) & 0xF);
+			if (tile != 0 && tile != tables.goalTile[cell]) {
+				misplaced++;
+			}
+		}
+		out[b] = misplaced;
+	}
+}
+
+#ifdef HEURISTIC_KERNELS_X86
+
+// spread the 16 nibbles of a board to one byte per cell, cell 0 in byte 0
+__attribute__((target("ssse3")))
+static inline __m128i spreadNibbles(uint64_t tiles) {
+	__m128i packed = _mm_cvtsi64_si128((long long)tiles);
+	__m128i low = _mm_and_si128(packed, _mm_set1_epi8(0x0F)); // even cells
+	__m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), _mm_set1_epi8(0x0F)); // odd cells
+	return _mm_unpacklo_epi8(low, high);
+}
+
+__attribute__((target("ssse3")))
+static void ssse3Manhattan(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	__m128i goalRow = _mm_load_si128((const __m128i*)tables.goalRow);
+	__m128i goalCol = _mm_load_si128((const __m128i*)tables.goalCol);
+	__m128i cellRow = _mm_load_si128((const __m128i*)tables.cellRow);
+	__m128i cellCol = _mm_load_si128((const __m128i*)tables.cellCol);
+	__m128i zero = _mm_setzero_si128();
+
+	for (int b = 0; b < count; b++) {
+		__m128i cells = spreadNibbles(tiles[b]);
+
+		// goal row and column of every tile in one shuffle each, minus its cell's
+		__m128i rows = _mm_abs_epi8(_mm_sub_epi8(_mm_shuffle_epi8(goalRow, cells), cellRow));
+		__m128i cols = _mm_abs_epi8(_mm_sub_epi8(_mm_shuffle_epi8(goalCol, cells), cellCol));
+
+		// the blank and the lanes past the last cell hold tile 0 and count nothing
+		__m128i distance = _mm_andnot_si128(_mm_cmpeq_epi8(cells, zero), _mm_add_epi8(rows, cols));
+
+		__m128i sums = _mm_sad_epu8(distance, zero); // one sum per 8 lanes
+		out[b] = _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+	}
+}
+
+__attribute__((target("ssse3")))
+static void ssse3Misplaced(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	__m128i goalTile = _mm_load_si128((const __m128i*)tables.goalTile);
+	__m128i zero = _mm_setzero_si128();
+
+	for (int b = 0; b < count; b++) {
+		__m128i cells = spreadNibbles(tiles[b]);
+
+		// lanes holding their goal tile or no tile
+		__m128i placed = _mm_or_si128(_mm_cmpeq_epi8(cells, goalTile), _mm_cmpeq_epi8(cells, zero));
+		out[b] = 16 - __builtin_popcount(_mm_movemask_epi8(placed));
+	}
+}
+
+// two boards per register, one in each 128-bit half (the shuffles work within halves)
+__attribute__((target("avx2")))
+static inline __m256i spreadNibblePair(uint64_t first, uint64_t second) {
+	__m128i packed = _mm_set_epi64x((long long)second, (long long)first);
+	__m128i low = _mm_and_si128(packed, _mm_set1_epi8(0x0F));
+	__m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), _mm_set1_epi8(0x0F));
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(low, high)),
+		_mm_unpackhi_epi8(low, high), 1);
+}
+
+__attribute__((target("avx2")))
+static void avx2Manhattan(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	__m256i goalRow = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)tables.goalRow));
+	__m256i goalCol = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)tables.goalCol));
+	__m256i cellRow = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)tables.cellRow));
+	__m256i cellCol = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)tables.cellCol));
+	__m256i zero = _mm256_setzero_si256();
+
+	int b = 0;
+	for (; b + 1 < count; b += 2) {
+		__m256i cells = spreadNibblePair(tiles[b], tiles[b + 1]);
+
+		__m256i rows = _mm256_abs_epi8(_mm256_sub_epi8(_mm256_shuffle_epi8(goalRow, cells), cellRow));
+		__m256i cols = _mm256_abs_epi8(_mm256_sub_epi8(_mm256_shuffle_epi8(goalCol, cells), cellCol));
+		__m256i distance = _mm256_andnot_si256(_mm256_cmpeq_epi8(cells, zero), _mm256_add_epi8(rows, cols));
+
+		__m256i sums = _mm256_sad_epu8(distance, zero);
+		__m128i first = _mm256_castsi256_si128(sums);
+		__m128i second = _mm256_extracti128_si256(sums, 1);
+		out[b] = _mm_cvtsi128_si32(first) + _mm_extract_epi16(first, 4);
+		out[b + 1] = _mm_cvtsi128_si32(second) + _mm_extract_epi16(second, 4);
+	}
+
+	// an odd board out
+	if (b < count) {
+		ssse3Manhattan(tiles + b, 1, tables, out + b);
+	}
+}
+
+__attribute__((target("avx2")))
+static void avx2Misplaced(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	__m256i goalTile = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)tables.goalTile));
+	__m256i zero = _mm256_setzero_si256();
+
+	int b = 0;
+	for (; b + 1 < count; b += 2) {
+		__m256i cells = spreadNibblePair(tiles[b], tiles[b + 1]);
+		__m256i placed = _mm256_or_si256(_mm256_cmpeq_epi8(cells, goalTile), _mm256_cmpeq_epi8(cells, zero));
+
+		unsigned int mask = (unsigned int)_mm256_movemask_epi8(placed); // 16 bits per board
+		out[b] = 16 - __builtin_popcount(mask & 0xFFFF);
+		out[b + 1] = 16 - __builtin_popcount(mask >> 16);
+	}
+
+	if (b < count) {
+		ssse3Misplaced(tiles + b, 1, tables, out + b);
+	}
+}
+
+#endif
+
+// the kernels one CPU runs
+struct KernelSet {
+	const char* name;
+	void (*manhattan)(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]);
+	void (*misplaced)(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]);
+};
+
+// the widest kernels the CPU supports, picked once
+static const KernelSet& kernels() {
+	static const KernelSet chosen = []() {
+#ifdef HEURISTIC_KERNELS_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			return KernelSet{ "avx2", avx2Manhattan, avx2Misplaced };
+		}
+		if (__builtin_cpu_supports("ssse3")) {
+			return KernelSet{ "ssse3", ssse3Manhattan, ssse3Misplaced };
+		}
+#endif
+		return KernelSet{ "scalar", scalarManhattan, scalarMisplaced };
+	}();
+	return chosen;
+}
+
+void nibbleManhattan(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	kernels().manhattan(tiles, count, tables, out);
+}
+
+void nibbleMisplaced(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]) {
+	kernels().misplaced(tiles, count, tables, out);
+}
+
+const char* heuristicKernelName() {
+	return kernels().name;
+}
@@ -0,0 +1,47 @@
+/* Slider Puzzle Heuristic Kernels
+*
+* Manhattan distance and misplaced tiles over batches of packed boards whose
+* cells take 4 bits (up to 16 cells, the 3x3 and 4x4 boards). A board's 16
+* nibbles are spread to one byte per cell, then byte shuffles (pshufb) look up
+* every tile's goal row and goal column at once and compare them with the
+* row and column of its cell; a sum of absolute differences adds up the lanes.
+* The SSSE3 kernel takes one board per register, the AVX2 kernel two. Both are
+* compiled w/ target attributes and picked at run time from what the CPU
+* supports, so the build needs no extra flags. They are built on x86-64
+* only; the scalar kernel is the fallback elsewhere and the reference.
+*
+* File:   heuristic_kernels.h
+*/
+
+#ifndef HEURISTIC_KERNELS_H
+#define HEURISTIC_KERNELS_H
+
+#include <cstdint>
+
+// goal and cell tables of one board size, one byte per nibble lane
+struct NibbleTables {
+
+	alignas(16) int8_t goalRow[16]; // goal row of each tile value, 0 for the blank
+
+	alignas(16) int8_t goalCol[16]; // goal column of each tile value, 0 for the blank
+
+	alignas(16) int8_t cellRow[16]; // row of each cell, 0 past the last cell
+
+	alignas(16) int8_t cellCol[16]; // column of each cell, 0 past the last cell
+
+	alignas(16) int8_t goalTile[16]; // tile value each cell holds in the goal state, 0 for the blank and past the last cell
+};
+
+// build the tables of a board size w/ at most 16 cells
+NibbleTables buildNibbleTables(int rows, int cols);
+
+// write the Manhattan distance of "count" nibble-packed boards
+void nibbleManhattan(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]);
+
+// write the number of misplaced tiles of "count" nibble-packed boards
+void nibbleMisplaced(const uint64_t tiles[], int count, const NibbleTables& tables, int out[]);
+
+// name of the kernels the CPU runs ("avx2", "ssse3" or "scalar")
+const char* heuristicKernelName();
+
+#endif
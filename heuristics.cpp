@@ -0,0 +1,252 @@
+/* Slider Puzzle Heuristics
+*
+* Linear conflict and walking distance. See heuristics.h.
+*
+* File:   heuristics.cpp
+*/
+
+#include "heuristics.h"
+
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// walking distances of every count matrix of "Lines" lines holding "Width" tiles each
+// A matrix counts the tiles of each line by goal line. Its key is the blank line
+// followed by every count but the last of each line (the line size fixes it),
+// in base Width + 1. Small key spaces index a flat table, larger ones a hash map.
+template <int Lines, int Width>
+class WalkingTable {
+public:
+
+	// BFS over the count matrices from the goal
+	WalkingTable();
+
+	// walking distance of a count matrix and its blank line
+	int distance(const int counts[Lines][Lines], int blankLine) const;
+
+private:
+
+	// key of a count matrix and its blank line
+	static uint64_t walkingKey(const int counts[Lines][Lines], int blankLine);
+
+	// count matrix and blank line of a key
+	static void unkey(uint64_t key, int counts[Lines][Lines], int& blankLine);
+
+	// number of keys, the flat table size
+	static uint64_t keySpace();
+
+	vector<uint8_t> flat; // distances indexed by key, 0xFF for matrices that cannot occur
+
+	unordered_map<uint64_t, uint8_t> hashed; // distances by key when the key space is too large to index
+};
+
+// longest key space kept in a flat table (16 MB)
+#define FLAT_WALKING_KEYS (1 << 24)
+
+// the table of one line shape, built on first use so a board size that never walks never pays for it
+template <int Lines, int Width>
+static const WalkingTable<Lines, Width>& walkingTable() {
+	static const WalkingTable<Lines, Width> table;
+	return table;
+}
+
+template <int Lines, int Width>
+uint64_t WalkingTable<Lines, Width>::keySpace() {
+	uint64_t keys = Lines;
+	for (int i = 0; i < Lines * (Lines - 1); i++) {
+		keys *= Width + 1;
+	}
+	return keys;
+}
+
+template <int Lines, int Width>
+uint64_t WalkingTable<Lines, Width>::walkingKey(const int counts[Lines][Lines], int blankLine) {
+	uint64_t key = blankLine;
+	for (int r = 0; r < Lines; r++) {
+		for (int g = 0; g < Lines - 1; g++) {
+			key = key * (Width + 1) + counts[r][g];
+		}
+	}
+	return key;
+}
+
+template <int Lines, int Width>
+void WalkingTable<Lines, Width>::unkey(uint64_t key, int counts[Lines][Lines], int& blankLine) {
+	for (int r = Lines - 1; r >= 0; r--) {
+		for (int g = Lines - 2; g >= 0; g--) {
+			counts[r][g] = key % (Width + 1);
+			key /= Width + 1;
+		}
+	}
+	blankLine = (int)key;
+
+	// the last count fills the line, the blank line holds one tile less
+	for (int r = 0; r < Lines; r++) {
+		counts[r][Lines - 1] = Width - (r == blankLine ? 1 : 0);
+		for (int g = 0; g < Lines - 1; g++) {
+			counts[r][Lines - 1] -= counts[r][g];
+		}
+	}
+}
+
+template <int Lines, int Width>
+WalkingTable<Lines, Width>::WalkingTable() {
+	bool isFlat = keySpace() <= FLAT_WALKING_KEYS;
+	if (isFlat) {
+		flat.assign(keySpace(), 0xFF);
+	}
+
+	// goal: every line holds its own tiles, the blank in the last line
+	int goal[Lines][Lines] = {};
+	for (int r = 0; r < Lines; r++) {
+		goal[r][r] = Width;
+	}
+	goal[Lines - 1][Lines - 1]--;
+
+	// breadth-first frontier of keys, read from the front index
+	vector<uint64_t> frontier;
+	frontier.push_back(walkingKey(goal, Lines - 1));
+	if (isFlat) {
+		flat[frontier[0]] = 0;
+	}
+	else {
+		hashed[frontier[0]] = 0;
+	}
+
+	for (size_t front = 0; front < frontier.size(); front++) {
+		int counts[Lines][Lines];
+		int blankLine;
+		unkey(frontier[front], counts, blankLine);
+		int walked = isFlat ? flat[frontier[front]] : hashed[frontier[front]];
+
+		// the blank swaps with a tile of any goal line from the line above or below
+		for (int step = -1; step <= 1; step += 2) {
+			int from = blankLine + step;
+			if (from < 0 || from >= Lines) {
+				continue;
+			}
+
+			for (int g = 0; g < Lines; g++) {
+				if (counts[from][g] == 0) {
+					continue;
+				}
+
+				counts[from][g]--;
+				counts[blankLine][g]++;
+				uint64_t key = walkingKey(counts, from);
+				counts[from][g]++;
+				counts[blankLine][g]--;
+
+				if (isFlat && flat[key] == 0xFF) {
+					flat[key] = (uint8_t)(walked + 1);
+					frontier.push_back(key);
+				}
+				else if (!isFlat && hashed.insert(make_pair(key, (uint8_t)(walked + 1))).second) {
+					frontier.push_back(key);
+				}
+			}
+		}
+	}
+}
+
+template <int Lines, int Width>
+int WalkingTable<Lines, Width>::distance(const int counts[Lines][Lines], int blankLine) const {
+	uint64_t key = walkingKey(counts, blankLine);
+	return flat.empty() ? hashed.find(key)->second : flat[key];
+}
+
+// length of the longest increasing subsequence of a short sequence
+static int longestIncreasing(const int values[], int n) {
+	int best = 0;
+	int length[8]; // longest run ending at each value, a line holds at most 8 tiles
+	for (int i = 0; i < n; i++) {
+		length[i] = 1;
+		for (int j = 0; j < i; j++) {
+			if (values[j] < values[i] && length[j] + 1 > length[i]) {
+				length[i] = length[j] + 1;
+			}
+		}
+		if (length[i] > best) {
+			best = length[i];
+		}
+	}
+	return best;
+}
+
+template <class P>
+int linearConflict(const typename P::Board& state) {
+	return P::manhattanDistance(state) + 2 * lineConflicts<P>(state);
+}
+
+template <class P>
+int lineConflicts(const typename P::Board& state) {
+	int conflicts = 0; // tiles that must leave their goal line
+
+	for (int line = 0; line < P::ROW; line++) {
+
+		// goal columns of the tiles standing in their goal row, in board order
+		int rowGoals[P::COL];
+		int rowCount = 0;
+
+		for (int k = 0; k < P::COL; k++) {
+			int rowTile = P::tileAt(state, line * P::COL + k);
+			if (rowTile != 0 && (rowTile - 1) / P::COL == line) {
+				rowGoals[rowCount++] = (rowTile - 1) % P::COL;
+			}
+		}
+
+		conflicts += rowCount - longestIncreasing(rowGoals, rowCount);
+	}
+
+	for (int line = 0; line < P::COL; line++) {
+
+		// goal rows of the tiles standing in their goal column, in board order
+		int colGoals[P::ROW];
+		int colCount = 0;
+
+		for (int k = 0; k < P::ROW; k++) {
+			int colTile = P::tileAt(state, k * P::COL + line);
+			if (colTile != 0 && (colTile - 1) % P::COL == line) {
+				colGoals[colCount++] = (colTile - 1) / P::COL;
+			}
+		}
+
+		conflicts += colCount - longestIncreasing(colGoals, colCount);
+	}
+
+	return conflicts;
+}
+
+template <class P>
+int walkingDistance(const typename P::Board& state) {
+
+	// the goal columns of a square board have the same shape as the goal rows, so one table serves both
+	const WalkingTable<P::ROW, P::COL>& rowTable = walkingTable<P::ROW, P::COL>();
+	const WalkingTable<P::COL, P::ROW>& colTable = walkingTable<P::COL, P::ROW>();
+
+	int rows[P::ROW][P::ROW] = {}; // tiles in each row by goal row
+	int cols[P::COL][P::COL] = {}; // tiles in each column by goal column
+
+	for (int cell = 0; cell < P::CELLS; cell++) {
+		int tile = P::tileAt(state, cell);
+		if (tile != 0) {
+			rows[cell / P::COL][(tile - 1) / P::COL]++;
+			cols[cell % P::COL][(tile - 1) % P::COL]++;
+		}
+	}
+
+	return rowTable.distance(rows, state.blank / P::COL) + colTable.distance(cols, state.blank % P::COL);
+}
+
+// the board sizes the program is built for
+template int linearConflict<Puzzle8>(const Puzzle8::Board& state);
+template int linearConflict<Puzzle15>(const Puzzle15::Board& state);
+template int linearConflict<Puzzle24>(const Puzzle24::Board& state);
+template int lineConflicts<Puzzle8>(const Puzzle8::Board& state);
+template int lineConflicts<Puzzle15>(const Puzzle15::Board& state);
+template int lineConflicts<Puzzle24>(const Puzzle24::Board& state);
+template int walkingDistance<Puzzle8>(const Puzzle8::Board& state);
+template int walkingDistance<Puzzle15>(const Puzzle15::Board& state);
+template int walkingDistance<Puzzle24>(const Puzzle24::Board& state);
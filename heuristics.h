@@ -0,0 +1,193 @@
+/* Slider Puzzle Heuristics
+*
+* Admissible heuristics and the policies that plug them into the informed
+* searches. A policy is a small struct with three const functions:
+*
+*     evaluate(state)                      full h(n) of a state
+*     update(h, child, tile, from, to)     h(n) of a child one move away, given its
+*                                          parent's h and the tile that slid from
+*                                          cell "from" to cell "to"
+*     updateBatch(h, batch, out)           h(n) of every child of one expansion
+*
+* The A* searches collect the children of a node into a ChildBatch first. Most
+* policies update each child on its own (updateEach), which is one table read
+* for the delta policies; the linear conflict policy takes the Manhattan part of
+* the whole batch from the SIMD kernels (heuristic_kernels.h).
+*
+* The searches take the policy type as a template parameter, so each heuristic
+* is inlined into its own specialized search loop. Policies that read a table
+* (pattern databases) carry a pointer to it; the others are empty. Each policy
+* is a template on the Puzzle (board size) it evaluates.
+*
+* File:   heuristics.h
+*/
+
+#ifndef HEURISTICS_H
+#define HEURISTICS_H
+
+#include "board.h"
+#include "pattern_db.h"
+
+// count/return the Manhattan distance plus two moves per linear conflict
+// Tiles in their goal row (column) that are in reverse order must step out of
+// it, so each tile beyond the longest correctly ordered subsequence costs 2.
+template <class P>
+int linearConflict(const typename P::Board& state);
+
+// count/return the two-move conflicts of linearConflict() without the Manhattan distance
+template <class P>
+int lineConflicts(const typename P::Board& state);
+
+// count/return the walking distance from the goal state
+// Tiles are only tracked by row (then by column) and the blank walks between
+// rows, swapping with any tile of a neighbor row. The fewest such moves to the
+// goal rows plus the fewest to the goal columns is precomputed once per board size.
+template <class P>
+int walkingDistance(const typename P::Board& state);
+
+// true if a board size has walking distance tables, the 5x5 ones take GBs and minutes to build
+template <class P>
+constexpr bool hasWalkingDistance() {
+	return P::ROW <= 4 && P::COL <= 4;
+}
+
+// the children generated by one expansion, a structure of arrays so the packed tiles sit back to back
+template <class P>
+struct ChildBatch {
+	static constexpr int CAPACITY = UP + 1; // one child per blank move
+
+	typename P::Tiles tiles[CAPACITY]; // packed tiles of each child
+
+	int tile[CAPACITY]; // tile that slid into the parent's blank cell
+
+	int from[CAPACITY]; // cell the tile slid from, the child's blank cell
+
+	int to[CAPACITY]; // cell the tile slid to, the parent's blank cell
+
+	int move[CAPACITY]; // Move code that produced the child
+
+	int count = 0; // number of children
+
+	// append a child made by sliding "tile" from cell "from" into the blank cell "to"
+	void add(const typename P::Board& child, int tile, int from, int to, int move) {
+		tiles[count] = child.tiles;
+		this->tile[count] = tile;
+		this->from[count] = from;
+		this->to[count] = to;
+		this->move[count] = move;
+		count++;
+	}
+
+	// the Board of a child
+	typename P::Board child(int c) const {
+		typename P::Board state = { tiles[c], from[c] };
+		return state;
+	}
+};
+
+// h(n) of every child of a batch through the policy's update(), for the policies w/o a batch kernel
+template <class P, class Heuristic>
+void updateEach(const Heuristic& heuristic, int h, const ChildBatch<P>& batch, int out[]) {
+	for (int c = 0; c < batch.count; c++) {
+		out[c] = heuristic.update(h, batch.child(c), batch.tile[c], batch.from[c], batch.to[c]);
+	}
+}
+
+// misplaced tiles policy, one delta table read per child
+template <class P>
+struct MisplacedPolicy {
+	int evaluate(const typename P::Board& state) const {
+		return P::misplacedTiles(state);
+	}
+
+	int update(int h, const typename P::Board&, int tile, int from, int to) const {
+		return h + P::misplacedDelta(tile, from, to);
+	}
+
+	void updateBatch(int h, const ChildBatch<P>& batch, int out[]) const {
+		updateEach(*this, h, batch, out);
+	}
+};
+
+// Manhattan distance policy, one delta table read per child
+template <class P>
+struct ManhattanPolicy {
+	int evaluate(const typename P::Board& state) const {
+		return P::manhattanDistance(state);
+	}
+
+	int update(int h, const typename P::Board&, int tile, int from, int to) const {
+		return h + P::manhattanDelta(tile, from, to);
+	}
+
+	void updateBatch(int h, const ChildBatch<P>& batch, int out[]) const {
+		updateEach(*this, h, batch, out);
+	}
+};
+
+// Manhattan distance plus linear conflict policy, re-evaluated per child
+// A batch takes the Manhattan part of every child from one SIMD kernel call.
+template <class P>
+struct LinearConflictPolicy {
+	int evaluate(const typename P::Board& state) const {
+		return linearConflict<P>(state);
+	}
+
+	int update(int, const typename P::Board& child, int, int, int) const {
+		return linearConflict<P>(child);
+	}
+
+	void updateBatch(int, const ChildBatch<P>& batch, int out[]) const {
+		P::manhattanBatch(batch.tiles, batch.count, out);
+		for (int c = 0; c < batch.count; c++) {
+			out[c] += 2 * lineConflicts<P>(batch.child(c));
+		}
+	}
+};
+
+// walking distance policy, re-evaluated per child from the precomputed table
+template <class P>
+struct WalkingDistancePolicy {
+	int evaluate(const typename P::Board& state) const {
+		return walkingDistance<P>(state);
+	}
+
+	int update(int, const typename P::Board& child, int, int, int) const {
+		return walkingDistance<P>(child);
+	}
+
+	void updateBatch(int h, const ChildBatch<P>& batch, int out[]) const {
+		updateEach(*this, h, batch, out);
+	}
+};
+
+// additive pattern database policy, only the pattern holding the moved tile is looked up again
+template <class P>
+struct PatternPolicy {
+	const PatternDatabaseSet* patterns; // open pattern databases for this board
+
+	int evaluate(const typename P::Board& state) const {
+		int where[P::CELLS];
+		P::tileCells(state, where);
+		return patterns->evaluate(where);
+	}
+
+	int update(int h, const typename P::Board& child, int tile, int from, int) const {
+		int pattern = patterns->patternOf(tile);
+		if (pattern < 0) {
+			return h; // the tile belongs to no pattern
+		}
+
+		int where[P::CELLS];
+		P::tileCells(child, where);
+		int after = patterns->evaluatePattern(pattern, where);
+		where[tile] = from;
+		return h - patterns->evaluatePattern(pattern, where) + after;
+	}
+
+	void updateBatch(int h, const ChildBatch<P>& batch, int out[]) const {
+		updateEach(*this, h, batch, out);
+	}
+};
+
+#endif
@@ -0,0 +1,137 @@
+/* Slider Puzzle Level BFS
+*
+* See level_bfs.h.
+*
+* File:   level_bfs.cpp
+*/
+
+#include "level_bfs.h"
+
+#include <thread>
+
+using namespace std;
+
+// ranks a worker takes from a level at a time
+const size_t CHUNK = 4096;
+
+// join the workers' lists into one
+static vector<uint32_t> gather(vector<vector<uint32_t> >& lists) {
+	size_t total = 0;
+	for (unsigned int w = 0; w < lists.size(); w++) {
+		total += lists[w].size();
+	}
+
+	vector<uint32_t> joined;
+	joined.reserve(total);
+	for (unsigned int w = 0; w < lists.size(); w++) {
+		joined.insert(joined.end(), lists[w].begin(), lists[w].end());
+		lists[w].clear();
+	}
+	return joined;
+}
+
+LevelBfs::LevelBfs(size_t space, int threads)
+	: space(space), threads(threads > 0 ? threads : (int)thread::hardware_concurrency()),
+	  visited((space + 63) / 64) {
+	if (this->threads < 1) {
+		this->threads = 1; // hardware_concurrency() may not know
+	}
+}
+
+int LevelBfs::workers() const {
+	return threads;
+}
+
+void LevelBfs::parallel(const function<void(int)>& work) const {
+	vector<thread> pool;
+	for (int w = 1; w < threads; w++) {
+		pool.push_back(thread(work, w));
+	}
+	work(0); // the calling thread is worker 0
+	for (unsigned int t = 0; t < pool.size(); t++) {
+		pool[t].join();
+	}
+}
+
+bool LevelBfs::claim(uint32_t rank) {
+	uint64_t bit = 1ULL << (rank & 63);
+
+	// a plain load first, most children of a deep level are already claimed
+	if (visited[rank >> 6].load(memory_order_relaxed) & bit) {
+		return false;
+	}
+	return !(visited[rank >> 6].fetch_or(bit, memory_order_relaxed) & bit);
+}
+
+bool LevelBfs::claimed(uint32_t rank) const {
+	return visited[rank >> 6].load(memory_order_relaxed) & (1ULL << (rank & 63));
+}
+
+vector<uint8_t> LevelBfs::run(const vector<uint32_t>& roots, const Expander& expand) {
+
+	// each rank's depth is written once, by the worker that claims it
+	vector<uint8_t> depth(space, 0xFF);
+	for (unsigned int w = 0; w < visited.size(); w++) {
+		visited[w].store(0, memory_order_relaxed);
+	}
+
+	vector<uint32_t> level;
+	for (unsigned int r = 0; r < roots.size(); r++) {
+		if (claim(roots[r])) {
+			depth[roots[r]] = 0;
+			level.push_back(roots[r]);
+		}
+	}
+
+	// per worker lists: states claimed on this level and children left for the next one
+	vector<vector<uint32_t> > same(threads);
+	vector<vector<uint32_t> > later(threads);
+
+	for (int d = 0; !level.empty(); d++) {
+
+		// expand the level, then whatever free moves added to it, until it is closed
+		vector<uint32_t> frontier = level;
+		while (!frontier.empty()) {
+			atomic<size_t> next(0);
+			parallel([&](int w) {
+				uint32_t child[MAX_CHILDREN];
+				int cost[MAX_CHILDREN];
+				for (size_t begin; (begin = next.fetch_add(CHUNK)) < frontier.size(); ) {
+					size_t end = min(begin + CHUNK, frontier.size());
+					for (size_t i = begin; i < end; i++) {
+						int count = expand(frontier[i], child, cost);
+						for (int c = 0; c < count; c++) {
+							if (cost[c] == 0) {
+								if (claim(child[c])) {
+									depth[child[c]] = (uint8_t)d;
+									same[w].push_back(child[c]);
+								}
+							}
+							else if (!claimed(child[c])) {
+								later[w].push_back(child[c]); // claimed once the level is closed
+							}
+						}
+					}
+				}
+			});
+			frontier = gather(same);
+		}
+
+		// claim the next level, duplicates and states claimed by free moves drop out
+		vector<uint32_t> candidates = gather(later);
+		atomic<size_t> next(0);
+		parallel([&](int w) {
+			for (size_t begin; (begin = next.fetch_add(CHUNK)) < candidates.size(); ) {
+				size_t end = min(begin + CHUNK, candidates.size());
+				for (size_t i = begin; i < end; i++) {
+					if (claim(candidates[i])) {
+						depth[candidates[i]] = (uint8_t)(d + 1);
+						same[w].push_back(candidates[i]);
+					}
+				}
+			}
+		});
+		level = gather(same);
+	}
+	return depth;
+}
@@ -0,0 +1,65 @@
+/* Slider Puzzle Level BFS
+*
+* Level-synchronous parallel breadth-first search over a ranked state space,
+* for the table builds that cover every state (the distance database) or every
+* placement of a pattern (the pattern databases). Each level is a vector of
+* ranks. Worker threads take chunks of the current level, expand them, and
+* claim the states of the next level with an atomic fetch_or on a shared
+* visited bitmap, so exactly one worker claims each state. The workers' claims
+* are joined into the next level and the levels swap.
+*
+* Moves cost 0 or 1 (the pattern databases only count moves of their own
+* tiles). Free moves stay on the current level, which is closed under them
+* before any state of the next level is claimed, so every state is claimed at
+* its smallest depth.
+*
+* File:   level_bfs.h
+*/
+
+#ifndef LEVEL_BFS_H
+#define LEVEL_BFS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// most children one state expands to, one per blank move
+#define MAX_CHILDREN 4
+
+// expands one rank: writes its children's ranks and move costs (0 or 1), returns their number
+typedef std::function<int(uint32_t rank, uint32_t child[MAX_CHILDREN], int cost[MAX_CHILDREN])> Expander;
+
+// level-synchronous BFS over the ranks [0, space)
+class LevelBfs {
+public:
+
+	// search a space of "space" ranks on "threads" workers, 0 for one per core
+	LevelBfs(size_t space, int threads);
+
+	// expand from the roots until no new state is reached, return each rank's depth (0xFF where unreached)
+	std::vector<uint8_t> run(const std::vector<uint32_t>& roots, const Expander& expand);
+
+	// number of workers
+	int workers() const;
+
+	// run work(worker) on every worker and wait for all of them
+	void parallel(const std::function<void(int)>& work) const;
+
+private:
+
+	// set the visited bit of a rank, return true if no worker set it before
+	bool claim(uint32_t rank);
+
+	// return true if a rank's visited bit is set
+	bool claimed(uint32_t rank) const;
+
+	size_t space; // number of ranks
+
+	int threads; // number of workers
+
+	std::vector<std::atomic<uint64_t> > visited; // visited bitmap, one bit per rank
+};
+
+#endif
@@ -9,12 +9,33 @@
 * the user know if the randomized state has a solution. (Some puzzle states cannot
 * be solved) The next option gives the user a choice to initialize the random state
 * for use in a search. The following four choices are for each respective search
-* method. At the conclusion of each search, the data structures and STL map are
-* reset to allow additional runs. Search results are written to a local .csv file
-* and the console screen. The final option shuts down the program.
+* method. Two more options build a distance database of every solvable state and
+* solve the start state by descending through it. The last three searches are
+* iterative-deepening A* (IDA*), which only keeps the current path in memory, with
+* the Manhattan distance and the stronger linear conflict and walking distance
+* heuristics (heuristics.h). Two more options build additive pattern databases
+* and run IDA* with them (pattern_db.h), then a bidirectional BFS grows the
+* smaller of the start and goal frontiers until they meet. The last two searches
+* spread A* over every core by state hash (hda.h) and IDA* by subtree
+* (parallel_ida.h).
+* Each search resets the Solver's data structures and visited states, so
+* additional runs reuse them. Search results are written to a
+* local .csv file and the console screen. The final option shuts down the program.
 *
-* Program notes: The programmer prefers string manipulation and thus, strings were
-* used to represent game states.
+* Batch mode: "--batch <algorithm> [input] [--out file] [--format csv|jsonl]
+* [--size 3x3|4x4|5x5]" skips the menu and solves one start state per input line,
+* see batch.h. The menu works on the 3x3 board, batch mode on any built size.
+* "--bench" times every search over a fixed-seed instance set bucketed by
+* optimal depth and writes a JSON report, see benchmark.h.
+*
+* Program notes: The searches live behind the reentrant Solver API (solver.h),
+* which other programs can embed directly. The board dimensions are template
+* parameters (board.h), so the 3x3, 4x4 and 5x5 boards each get their own
+* specialized solver. States are packed into one word per Board. Strings are
+* only used to generate, print and report states.
+*
+* Build: g++ -std=c++14 -O2 -pthread *.cpp (the batch workers and database builds use std::thread),
+* add -DSLIDER_PROFILE for the hot path profiler (profiler.h)
 *
 * File:   main.cpp
 * Author: Nick Kinderman
@@ -30,387 +51,414 @@
 #include <fstream>
 #include <string>
 #include <vector>
-#include <map>
-#include <queue>
-#include <stack>
-
-using namespace std;
-
-//------------------ Globals Declarations/Definitions ------------------------//
-
-#define ROW 3  // row length
-#define COL 3  // col length
-
-// constant goal state of puzzle
-const string GOALSTATE = "12345678E";
 
-// write program report to data file
-ofstream outFile;
+#include "board.h"
+#include "distance_db.h"
+#include "solver.h"
+#include "batch.h"
+#include "benchmark.h"
 
-// X & Y points in the puzzle 2d array
-struct Point {
-	int x;
-	int y;
-};
-
-// game data object w/ declared "curr" and "neighbor" nodes
-struct Node {
-
-	// clear the vector and state data
-	void clear() {
-		state.clear();
-		path.clear();
-	}
-
-	int point; // current empty node coordinate
-
-	string state; // current state of the puzzle
+using namespace std;
 
-	int depth; // current depth of the search
+// the menu works on the 3x3 board
+typedef Puzzle8 P;
 
-	vector<string>path; // current path of the puzzle
+//------------------ Globals Declarations/Definitions ------------------------//
 
-	int count; // counter for generated nodes
+// a random state to be generated from the GOALSTATE
+string generatedState = P::goalString();
 
-	int cheapest;  // the A* f(n) value
+// start state of the puzzle, initialized to GOALSTATE to check for initialization status
+string startState = P::goalString();
 
-}curr, neighbor;
+//------------------------- Function Declarations ----------------------------//
 
-// comparison object for the priority queues
-// compares and sorts the queue according to the cheapest A* f(n)value
-struct compare{
-    bool operator()(const Node & a, const Node & b){
-        return a.cheapest > b.cheapest;
-     }
-};
+// generate a random starting state and test for a solution
+void generateState();
 
-// a random state to be generated from the GOALSTATE
-string generatedState = GOALSTATE;
+// convert string to int and put this int into an array
+void stringToInt(string stringState, int intState, int testArray[9]);
 
-// start state of the puzzle, initialized to GOALSTATE to check for initialization status
-string startState = GOALSTATE;
+// copied from http://www.geeksforgeeks.org/check-instance-8-puzzle-solvable/
+// return true if inversion count of puzzle is even.
+bool isSolvable(int puzzle[3][3]);
 
-// final state returned from the chosen search method
-string endState;
+// initialize a starting state
+void initializeState();
 
-// 2D array of puzzle
-char puzzle[ROW][COL];
+// populate an int 2D array (puzzle) w/ int array representation of the state
+void populateIntPuzzle(int intArray[9], int intPuzzle[P::ROW][P::COL]);
 
-// declare and initialize counter
-int counter = 1; 
+// Print some results to console and write all results to a .csv file
+void results(const SolveResult& result);
 
-// marks the data structure to use
-int dataStructure;
+//----------------------------- Program Main ---------------------------------//
 
-// visited status map
-map <string, int> visited;
+int main(int argc, char* argv[]) {
 
-// create a queue of Nodes for the BFS search
-queue<Node> bfsQueue;
+	// non-interactive batch mode skips the menu
+	if (argc > 1 && string(argv[1]) == "--batch") {
+		return runBatch(argc, argv);
+	}
+	if (argc > 1 && string(argv[1]) == "--bench") {
+		return runBenchmark(argc, argv);
+	}
 
-// create a stack of Nodes for the DFS search
-stack<Node> dfsStack;
+	srand(time(NULL)); // for use in randomizing the random_shuffle function in STL <algorithm>
 
-// create a priority queue of Nodes for the A* search w/ misplaced tiles heuristic
-priority_queue<Node,vector<Node>,compare> aStarOutofPlace;
+	int menu = 0; // menu options variable
 
-// create a priority queue of Nodes for the A* search w/ Manhattan distance heuristic
-priority_queue<Node,vector<Node>,compare> aStarManhattan;
+	Solver<P> solver; // search state used by the menu, reused by every search
 
-// permanent puzzle tile coordinates - used in tile swap functions
-const Point one = { 0, 0 };
-const Point two = { 0, 1 };
-const Point three = { 0, 2 };
-const Point four = { 1, 0 };
-const Point five = { 1, 1 };
-const Point six = { 1, 2 };
-const Point seven = { 2, 0 };
-const Point eight = { 2, 1 };
-const Point nine = { 2, 2 };
+	DistanceDatabase database; // distance database, mapped on first use
 
-//------------------------- Function Declarations ----------------------------//
+	PatternDatabaseSet patterns; // additive pattern databases, mapped on first use
 
-// generate a random starting state and test for a solution
-void generateState();
+	SolveOptions options; // the DB searches use the databases once they are open
+	options.database = &database;
+	options.patterns = &patterns;
 
-// convert string to int and put this int into an array
-void stringToInt(string stringState, int intState, int testArray[9]);
+	SolveResult result; // result of the last search
 
-// copied from http://www.geeksforgeeks.org/check-instance-8-puzzle-solvable/
-// find inversion count of a given array
-int getInvCount(int arr[]);
+	cout << "Welcome to Puzzle Slider 9000!" << endl;
 
-// copied from http://www.geeksforgeeks.org/check-instance-8-puzzle-solvable/
-// return true if inversion count of puzzle is even.
-bool isSolvable(int puzzle[3][3]);
+	while (menu != 99) {
 
-// initialize a starting state and clear STL map, queue and stack
-void initializeState();
+		cout << endl;
 
-// clear the STL map, queue and stack, and priority queue
-void clear();
+		// Choose an option
+		cout << "1. Generate a random state: " << endl;
+		cout << "2. Initialize working state: " << endl;
+		cout << "3. Breadth-First Search: " << endl;
+		cout << "4. Depth-First Search: " << endl;
+                cout << "5. A* Search w/ misplaced tiles: " << endl;
+                cout << "6. A* Search w/ manhattan distance: " << endl;
+		cout << "7. Build distance database: " << endl;
+		cout << "8. Distance database lookup: " << endl;
+		cout << "9. IDA* Search w/ manhattan distance: " << endl;
+		cout << "10. IDA* Search w/ linear conflict: " << endl;
+		cout << "11. IDA* Search w/ walking distance: " << endl;
+		cout << "12. Build pattern databases: " << endl;
+		cout << "13. IDA* Search w/ pattern databases: " << endl;
+		cout << "14. Bidirectional Breadth-First Search: " << endl;
+		cout << "15. Parallel A* Search w/ manhattan distance: " << endl;
+		cout << "16. Parallel IDA* Search w/ manhattan distance: " << endl;
+		cout << "99. Exit the application: " << endl;
 
-// populate an int 2D array (puzzle) w/ int array representation of the state
-void populateIntPuzzle(int intArray[9], int intPuzzle[ROW][COL]);
+		cout << endl;
+		cout << endl;
+		cout << "Choose an option. ";
 
-// populate a char 2D array (puzzle) w/ string state
-void populatePuzzle(string startState, char puzzle[ROW][COL]);
+		// user input
+		cin >> menu;
 
-// print 2D array (puzzle)
-void printPuzzle(char puzzle[ROW][COL]);
+		switch (menu) {
 
-// swap one and two positions
-string oneTwo(char puzzle[ROW][COL]);
+		case 1:
+			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
 
-// swap one and four positions
-string oneFour(char puzzle[ROW][COL]);
+			// generate a random state and check for solvability
+			generateState();
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// swap two and three positions
-string twoThree(char puzzle[ROW][COL]);
+		case 2:
+			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
 
-// swap two and five positions
-string twoFive(char puzzle[ROW][COL]);
+			// set a start state from a randomized state
+			initializeState();
 
-// swap three and six positions
-string threeSix(char puzzle[ROW][COL]);
+			cout << "Your initialized start state is: " << startState << endl;
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// swap four and seven positions
-string fourSeven(char puzzle[ROW][COL]);
+		case 3:
+			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
 
-// swap four and five positions
-string fourFive(char puzzle[ROW][COL]);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Randomize and initialize a new start state to begin a search!" << endl;
+				break;
+			}
 
-// swap five and eight positions
-string fiveEight(char puzzle[ROW][COL]);
+			// BFS of puzzle, return the search result
+			result = solver.solve(startState, BFS, options);
 
-// swap five and six positions
-string fiveSix(char puzzle[ROW][COL]);
+			// print search results to console and write to a .csv file
+			results(result);
 
-// swap six and nine positions
-string sixNine(char puzzle[ROW][COL]);
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// swap seven and eight positions
-string sevenEight(char puzzle[ROW][COL]);
+		case 4:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// swap eight and nine positions
-string eightNine(char puzzle[ROW][COL]);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-// swap pattern for empty tile on 1
-void tileOne(string tempState);
+			// DFS of puzzle, return the search result
+			result = solver.solve(startState, DFS, options);
 
-// swap pattern for empty tile on 2
-void tileTwo(string tempState);
+			// print search results to console and write to a .csv file
+			results(result);
 
-// swap pattern for empty tile on 3
-void tileThree(string tempState);
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// swap pattern for empty tile on 4
-void tileFour(string tempState);
+                case 5:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// swap pattern for empty tile on 5
-void tileFive(string tempState);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-// swap pattern for empty tile on 6
-void tileSix(string tempState);
+			// A* search of puzzle(with misplaced tiles), return the search result
+			result = solver.solve(startState, OOPL, options);
 
-// swap pattern for empty tile on 7
-void tileSeven(string tempState);
+			// print search results to console and write to a .csv file
+			results(result);
 
-// swap pattern for empty tile on 8
-void tileEight(string tempState);
+                        menu = 99;
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// swap pattern for empty tile on 9
-void tileNine(string tempState);
+                case 6:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// build & return current puzzle state
-string puzzleState(char puzzle[ROW][COL]);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-// insert non-visited state to map
-void insertMap(string state, int depth);
+			// A* search of puzzle(with Manhattan distance), return the search result
+			result = solver.solve(startState, MHTTN, options);
 
-// check if visited status is on map
-bool checkMap(string state);
+			// print search results to console and write to a .csv file
+			results(result);
 
-// check for goal state
-bool checkGoal(string workingState);
+                        menu= 99;
+                        cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// count/return the number of misplaced tiles from the goal state
-int misplacedTiles(string state);
+		case 7:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// count/return the Manhattan distance from the goal state
-int manhattanDistance(string state);
+			// BFS out from the goal state once and save every distance to a file
+			if (DistanceDatabase::build(DATABASE_FILE) && database.open(DATABASE_FILE)) {
+				cout << "Distance database written to (" << DATABASE_FILE << ")" << endl;
+			}
+			else {
+				cout << "The distance database could not be written!" << endl;
+			}
 
-// build a temporary node
-void buildNode(int counter, string tempState, string tempPath);
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// insert node into a data structure
-void insertDataStructure(string tempPath);
+		case 8:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// find and return empty tile location
-int findEmpty(string state);
+			// map the distance database on first use
+			if (!database.isOpen() && !database.open(DATABASE_FILE)) {
+				cout << "Build the distance database before using it!" << endl;
+				break;
+			}
 
-// initiate search based on tile position
-void searchPattern(int tile, string workingState);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-// Breadth-first search function to find possible solution to puzzle
-string bfs(string startState, char puzzle[ROW][COL]);
+			// walk the distance database from the start state, return the search result
+			result = solver.solve(startState, DB, options);
 
-// Depth-first search function to find possible solution to puzzle
-string dfs(string startState, char puzzle[ROW][COL]);
+			// print search results to console and write to a .csv file
+			results(result);
 
-// A* search function to find possible solution to puzzle w/ misplaced tiles heuristic
-string oopl(string startState, char puzzle[ROW][COL]);
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-// A* search function to find possible solution to puzzle w/ Manhattan distance heuristic
-string mhttn(string startState, char puzzle[ROW][COL]);
+		case 9:
+			cout << string(50, '\n'); // console spacing for universal output
 
-// Print some results to console and write all results to a .csv file
-void results(string endState);
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-//----------------------------- Program Main ---------------------------------//
+			// IDA* search of puzzle(with Manhattan distance), return the search result
+			result = solver.solve(startState, IDA, options);
 
-int main() {
+			// print search results to console and write to a .csv file
+			results(result);
 
-	srand(time(NULL)); // for use in randomizing the random_shuffle function in STL <algorithm>
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-	int menu = 0; // menu options variable
+		case 10:
+			cout << string(50, '\n'); // console spacing for universal output
 
-	cout << "Welcome to Puzzle Slider 9000!" << endl;
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-	while (menu != 99) {
+			// IDA* search of puzzle(with linear conflict), return the search result
+			result = solver.solve(startState, IDA_LC, options);
 
-		cout << endl;
+			// print search results to console and write to a .csv file
+			results(result);
 
-		// Choose an option
-		cout << "1. Generate a random state: " << endl;
-		cout << "2. Initialize working state: " << endl;
-		cout << "3. Breadth-First Search: " << endl;
-		cout << "4. Depth-First Search: " << endl;
-                cout << "5. A* Search w/ misplaced tiles: " << endl;
-                cout << "6. A* Search w/ manhattan distance: " << endl;
-		cout << "99. Exit the application: " << endl;
+			cout << endl;
+			cout << endl;
+			cout << "What would you like to do next?" << endl;
+			break;
 
-		cout << endl;
-		cout << endl;
-		cout << "Choose an option. ";
+		case 11:
+			cout << string(50, '\n'); // console spacing for universal output
 
-		// user input
-		cin >> menu;
+			// Check to see if a random state was generated
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
+				break;
+			}
 
-		switch (menu) {
+			// IDA* search of puzzle(with walking distance), return the search result
+			result = solver.solve(startState, IDA_WD, options);
 
-		case 1:
-			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
+			// print search results to console and write to a .csv file
+			results(result);
 
-			// generate a random state and check for solvability
-			generateState();
 			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
 
-		case 2:
-			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
+		case 12:
+			cout << string(50, '\n'); // console spacing for universal output
 
-			// set a start state from a randomized state and clear data structures for reuse
-			initializeState();
+			// BFS out from the goal once per pattern and save the patterns to a file
+			if (PatternDatabaseSet::build(patternFile(P::ROW, P::COL), P::ROW, P::COL, defaultPartition(P::ROW, P::COL))
+				&& patterns.open(patternFile(P::ROW, P::COL), P::ROW, P::COL)) {
+				cout << "Pattern databases written to (" << patternFile(P::ROW, P::COL) << ")" << endl;
+			}
+			else {
+				cout << "The pattern databases could not be written!" << endl;
+			}
 
-			cout << "Your initialized start state is: " << startState << endl;
 			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
 
-		case 3:
-			cout << string(50, '\n'); // console spacing for universal output on different IDEs and computers
+		case 13:
+			cout << string(50, '\n'); // console spacing for universal output
 
-			// BFS of puzzle, return final node state
-			endState = bfs(startState, puzzle);
+			// map the pattern databases on first use
+			if (!patterns.isOpen() && !patterns.open(patternFile(P::ROW, P::COL), P::ROW, P::COL)) {
+				cout << "Build the pattern databases before using them!" << endl;
+				break;
+			}
 
 			// Check to see if a random state was generated
-			if (endState == "error") {
-				cout << "Randomize and initialize a new start state to begin a search!" << endl;
+			if (startState == P::goalString()) {
+				cout << "Initialize a new startState to begin a search!" << endl;
 				break;
 			}
 
-			// print search results to console and write to a .csv file
-			results(endState);
+			// IDA* search of puzzle(with pattern databases), return the search result
+			result = solver.solve(startState, IDA_PDB, options);
 
-                        // clear data structures and map for reuse
-                        clear();
+			// print search results to console and write to a .csv file
+			results(result);
 
 			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
 
-		case 4:
+		case 14:
 			cout << string(50, '\n'); // console spacing for universal output
 
-			// DFS of puzzle, return final node state
-			endState = dfs(startState, puzzle);
-
 			// Check to see if a random state was generated
-			if (endState == "error") {
+			if (startState == P::goalString()) {
 				cout << "Initialize a new startState to begin a search!" << endl;
 				break;
 			}
 
-			// print search results to console and write to a .csv file
-			results(endState);
+			// bidirectional BFS of puzzle, return the search result
+			result = solver.solve(startState, BIBFS, options);
 
-                        // clear data structures and map for reuse
-                        clear();
+			// print search results to console and write to a .csv file
+			results(result);
 
 			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
 
-                case 5:
+		case 15:
 			cout << string(50, '\n'); // console spacing for universal output
 
-			// A* search of puzzle(with misplaced tiles), return final node state
-			endState = oopl(startState, puzzle);
-
 			// Check to see if a random state was generated
-			if (endState == "error") {
+			if (startState == P::goalString()) {
 				cout << "Initialize a new startState to begin a search!" << endl;
 				break;
 			}
 
-			// print search results to console and write to a .csv file
-			results(endState);
+			// hash-distributed A* of puzzle on every core, return the search result
+			result = solver.solve(startState, HDA, options);
 
-                        // clear data structures and map for reuse
-                        clear();
+			// print search results to console and write to a .csv file
+			results(result);
 
-                        menu = 99;
 			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
 
-                case 6:
+		case 16:
 			cout << string(50, '\n'); // console spacing for universal output
 
-			// A* search of puzzle(with Manhattan distance), return final node state
-			endState = mhttn(startState, puzzle);
-
 			// Check to see if a random state was generated
-			if (endState == "error") {
+			if (startState == P::goalString()) {
 				cout << "Initialize a new startState to begin a search!" << endl;
 				break;
 			}
 
-			// print search results to console and write to a .csv file
-			results(endState);
+			// IDA* of puzzle w/ its subtrees spread over every core, return the search result
+			result = solver.solve(startState, PIDA, options);
 
-                        // clear data structures and map for reuse
-                        clear();
+			// print search results to console and write to a .csv file
+			results(result);
 
-                        menu= 99;
-                        cout << endl;
+			cout << endl;
 			cout << endl;
 			cout << "What would you like to do next?" << endl;
 			break;
@@ -447,7 +495,7 @@ void generateState() {
 	stringToInt(generatedState, intState, testArray);
 
 	// 2d integer array to test solution
-	int intPuzzle[ROW][COL];
+	int intPuzzle[P::ROW][P::COL];
 
 	// populate an int 2D array with an int 1D array
 	populateIntPuzzle(testArray, intPuzzle);
@@ -490,22 +538,10 @@ void stringToInt(string stringState, int intState, int testArray[9]) {
 	}
 }
 
-int getInvCount(int arr[])
-{
-	// find inversion count of a given array
-	int inv_count = 0;
-	for (int i = 0; i < 9 - 1; i++)
-		for (int j = i + 1; j < 9; j++)
-			// Value 0 is used for empty space
-			if (arr[j] && arr[i] && arr[i] > arr[j])
-				inv_count++;
-	return inv_count;
-}
-
 bool isSolvable(int puzzle[3][3])
 {
 	// fetch inversion count in given array
-	int invCount = getInvCount((int *)puzzle);
+	int invCount = getInvCount((int *)puzzle, 9);
 
 	// return true if inversion count is even.
 	return (invCount % 2 == 0);
@@ -517,1193 +553,68 @@ void initializeState() {
 	startState = generatedState;
 }
 
-// clear the STL map, queue, stack, and priority queue
-void clear(){
-    // initialize counter to 1
-	counter = 1;
-
-	// clear the STL map
-	visited.clear();
-
-	// empty the bfsQueue
-	while (!bfsQueue.empty()) bfsQueue.pop();
-
-	// empty the dfsStack
-	while (!dfsStack.empty()) dfsStack.pop();
-
-        // empty the dfsStack
-	while (!aStarOutofPlace.empty()) aStarOutofPlace.pop();
-
-        // empty the dfsStack
-	while (!aStarManhattan.empty()) aStarManhattan.pop();
-}
-
 // populate an integer 2d array with an integer 1d array
-void populateIntPuzzle(int intArray[9], int intPuzzle[ROW][COL]) {
+void populateIntPuzzle(int intArray[9], int intPuzzle[P::ROW][P::COL]) {
 	int count = 0;
-	for (int i = 0; i < ROW; i++) {
-		for (int j = 0; j < COL; j++) {
+	for (int i = 0; i < P::ROW; i++) {
+		for (int j = 0; j < P::COL; j++) {
 			intPuzzle[i][j] = intArray[count];
 			count++;
 		}
 	}
 }
 
-// populate a char 2D array (puzzle) w/ a string state
-void populatePuzzle(string startState, char puzzle[ROW][COL]) {
-	int count = 0;
-	for (int i = 0; i < ROW; i++) {
-		for (int j = 0; j < COL; j++) {
-			puzzle[i][j] = startState[count];
-			count++;
-		}
-	}
-}
+void results(const SolveResult& result) {
 
-// print 2D array (puzzle) - used for testing/debugging
-void printPuzzle(char puzzle[ROW][COL]) {
-	cout << "The Puzzle" << endl;
-	for (int i = 0; i < ROW; i++) {
-		for (int j = 0; j < COL; j++) {
-			cout << puzzle[i][j] << "\t";
-		}
-		cout << endl;
-	}
-	cout << endl;
-}
+	// write program report to data file
+	ofstream outFile;
 
-// swap one and two positions
-string oneTwo(char puzzle[ROW][COL]) {
-	char temp = puzzle[one.x][one.y];
-	puzzle[one.x][one.y] = puzzle[two.x][two.y];
-	puzzle[two.x][two.y] = temp;
+	// anything but a solved state results in an unsuccessful search
+	if (result.status == UNSOLVABLE) {
+		cout << "Solution was not found (the start state is not solvable)" << endl;
+	}
+	else if (result.status != SOLVED) {
+		cout << "Solution was not found" << endl;
+	}
+	else {
+		cout << "Search successful!" << endl;
+	}
 
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap one and four positions
-string oneFour(char puzzle[ROW][COL]) {
-	char temp = puzzle[one.x][one.y];
-	puzzle[one.x][one.y] = puzzle[four.x][four.y];
-	puzzle[four.x][four.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap two and three positions
-string twoThree(char puzzle[ROW][COL]) {
-	char temp = puzzle[two.x][two.y];
-	puzzle[two.x][two.y] = puzzle[three.x][three.y];
-	puzzle[three.x][three.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap two and five positions
-string twoFive(char puzzle[ROW][COL]) {
-	char temp = puzzle[two.x][two.y];
-	puzzle[two.x][two.y] = puzzle[five.x][five.y];
-	puzzle[five.x][five.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap three and six positions
-string threeSix(char puzzle[ROW][COL]) {
-	char temp = puzzle[three.x][three.y];
-	puzzle[three.x][three.y] = puzzle[six.x][six.y];
-	puzzle[six.x][six.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap four and seven positions
-string fourSeven(char puzzle[ROW][COL]) {
-	char temp = puzzle[four.x][four.y];
-	puzzle[four.x][four.y] = puzzle[seven.x][seven.y];
-	puzzle[seven.x][seven.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap four and five positions
-string fourFive(char puzzle[ROW][COL]) {
-	char temp = puzzle[four.x][four.y];
-	puzzle[four.x][four.y] = puzzle[five.x][five.y];
-	puzzle[five.x][five.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap five and eight positions
-string fiveEight(char puzzle[ROW][COL]) {
-	char temp = puzzle[five.x][five.y];
-	puzzle[five.x][five.y] = puzzle[eight.x][eight.y];
-	puzzle[eight.x][eight.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap five and six positions
-string fiveSix(char puzzle[ROW][COL]) {
-	char temp = puzzle[five.x][five.y];
-	puzzle[five.x][five.y] = puzzle[six.x][six.y];
-	puzzle[six.x][six.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap six and nine positions
-string sixNine(char puzzle[ROW][COL]) {
-	char temp = puzzle[six.x][six.y];
-	puzzle[six.x][six.y] = puzzle[nine.x][nine.y];
-	puzzle[nine.x][nine.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap seven and eight positions
-string sevenEight(char puzzle[ROW][COL]) {
-	char temp = puzzle[seven.x][seven.y];
-	puzzle[seven.x][seven.y] = puzzle[eight.x][eight.y];
-	puzzle[eight.x][eight.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap eight and nine positions
-string eightNine(char puzzle[ROW][COL]) {
-	char temp = puzzle[eight.x][eight.y];
-	puzzle[eight.x][eight.y] = puzzle[nine.x][nine.y];
-	puzzle[nine.x][nine.y] = temp;
-
-	string tempState = puzzleState(puzzle);
-	return tempState;
-}
-
-// swap pattern for empty tile on 1
-void tileOne(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 1 to 2 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = oneTwo(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter);  // insert state & counter into map
-		tempPath = "1 to 2,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 1 to 4 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = oneFour(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "1 to 4,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileTwo(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 2 to 3 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = twoThree(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "2 to 3,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 2 to 5 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = twoFive(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "2 to 5,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- third check, 2 to 1 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = oneTwo(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "2 to 1,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileThree(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 3 to 6 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = threeSix(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "3 to 6,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 3 to 2 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = twoThree(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "3 to 2,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileFour(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 4 to 5 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fourFive(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "4 to 5,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 4 to 7 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fourSeven(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "4 to 7,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- third check, 4 to 1 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = oneFour(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "4 to 1,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileFive(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 5 to 6 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fiveSix(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "5 to 6,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 5 to 8 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fiveEight(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "5 to 8,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- third check, 5 to 4 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fourFive(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "5 to 4,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- fourth check, 5 to 2 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = twoFive(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "5 to 2,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileSix(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 6 to 9 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = sixNine(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "6 to 9,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 6 to 5 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fiveSix(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "6 to 5,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- third check, 6 to 3 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = threeSix(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "6 to 3,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileSeven(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 7 to 8 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = sevenEight(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "7 to 8,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 7 to 4 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fourSeven(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "7 to 4,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileEight(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 8 to 9 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = eightNine(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "8 to 9,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 8 to 7 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = sevenEight(tempPuzzle);
-
-
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "8 to 7,"; // assign string value to tempPath
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- third check, 8 to 5 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = fiveEight(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "8 to 5,";
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-void tileNine(string workingState) {
-
-	// temp 2D puzzle for swap use
-	char tempPuzzle[ROW][COL];
-
-	// temp state for swap use
-	string tempState;
-
-	// temp path for swap use
-	string tempPath;
-
-	// ---------- first check, 9 to 8 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = eightNine(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "9 to 8,";
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-
-	// ---------- second check, 9 to 6 ---------- //
-
-	// build a temp puzzle with current workingState
-	populatePuzzle(workingState, tempPuzzle);
-
-	// build temp state from swapped puzzle
-	tempState = sixNine(tempPuzzle);
-
-	// check map for visited state
-	if (!checkMap(tempState)) {
-
-		counter++; // increment counter
-		insertMap(tempState, counter); // insert state & counter into map
-		tempPath = "9 to 6,";
-
-		buildNode(counter, tempState, tempPath); // build a temporary node with updated data
-		insertDataStructure(tempPath); // insert node into the data structure that the search is using
-	}
-}
-
-// build and return string state representation of a 2D array (puzzle)
-string puzzleState(char puzzle[ROW][COL]) {
-
-	string state; // declaration
-	state.resize(9); // set size to 9 characters
-
-	// build a string state from a 2D char puzzle
-	int count = 0;
-	for (int i = 0; i < ROW; i++) {
-		for (int j = 0; j < COL; j++) {
-			state[count] = puzzle[i][j];
-			count++;
-		}
-	}
-	return state;
-};
-
-void insertMap(string state, int counter) {
-	// insert state and counter to map
-	visited.insert(pair <string, int>(state, counter));
-}
-
-// search map for visited status and return boolean value
-bool checkMap(string state) {
-	map <string, int> ::iterator itr;
-	for (itr = visited.begin(); itr != visited.end(); ++itr)
-	{
-		// if state is found in map return true
-		if (state == itr->first) {
-			return true;
-		}
-	}
-	return false; // if state is not in the map, return false
-}
-
-// check for goal state and return boolean status
-bool checkGoal(string state) {
-	if (state == GOALSTATE) {
-		return true;
-	}
-	else {
-		return false;
-	}
-}
-
-// count/return the number of misplaced tiles from the goal state
-int misplacedTiles(string state){
-    int tiles = 0;
-
-    for(int i = 0; i < state.length() - 1; i++){
-        // if string element != goal string element, increment tiles #
-        if(state[i] != GOALSTATE[i]){
-            tiles += 1;
-        }
-    }
-    return tiles;
-}
-
-// count/return the Manhattan distance from the goal state
-int manhattanDistance(string state){
-
-    int intState = 0; // holds a integer representation of a string state
-    int intArray[9]; // array to store converted integer
-
-    // converts temporary String state to integer intState and stores intState in integer intArray
-    stringToInt(state, intState, intArray);
-
-    // 2d integer array to calculate Manhattan distance
-    int intPuzzle[ROW][COL];
-
-    // populate an int 2D array with an int 1D array
-    populateIntPuzzle(intArray, intPuzzle);
-
-    int value = 0; // puzzle tile value
-    Point temp = {0,0}; // temporary puzzle coordinates
-    Point goal = {0,0}; // goal state coordinates
-    int mDis = 0; // Manhattan distance variable
-
-    // compare the current state tiles with the goal tile locations
-    for(int i = 0; i < 3; i++){
-        for(int j = 0; j < 3; j++){
-            value = intPuzzle[i][j];
-            //
-            if(value != 0){
-                temp = {i,j};
-                goal = {(value - 1) / 3, (value - 1) % 3};
-                mDis += abs(temp.x - goal.x) + abs(temp.y - goal.y);
-            }
-        }
-    }
-    return mDis;
-}
-
-// build a temp node with current state data
-void buildNode(int counter, string tempState, string tempPath) {
-
-	neighbor.state = tempState;  // assign tempState
-	neighbor.depth = curr.depth + 1; // working node depth + 1
-	neighbor.count = counter; // assign counter
-
-};
-
-// insert node into the data structure that the search is using
-void insertDataStructure(string tempPath) {
-
-	// int dataStructure is initialized in BFS or DFS search functions
-	switch (dataStructure) {
-	case 1: // 1 equals BFS
-
-                neighbor.path = curr.path; // copy current path
-                neighbor.path.push_back(tempPath); // insert temp path into vector
-                bfsQueue.push(neighbor);  // enqueue neighbor node
-
-		// clear the vector and state data of this temp node to deallocate memory
-		neighbor.clear();
-		break;
-
-	case 2: // 2 equals DFS
-
-
-		dfsStack.push(neighbor); // push neighbor node onto stack
-
-		// clear the vector and state data of this temp node to deallocate memory
-		neighbor.clear();
-		break;
-
-        case 3: // 3 equals A* search w/ misplaced tiles heuristic
-
-                // f(n) = g(n) + h(n): [cheapest = depth + misplaced tiles]
-                neighbor.cheapest = neighbor.depth + misplacedTiles(neighbor.state);
-
-                neighbor.path = curr.path; // copy current path
-                neighbor.path.push_back(tempPath); // insert temp path into vector
-                aStarOutofPlace.push(neighbor);
-
-                // clear the vector and state data of this temp node to deallocate memory
-                neighbor.clear();
-                break;
-
-        case 4: // 4 equals A* search w/ Manhattan heuristic
-
-                // f(n) = g(n) + h(n): [cheapest = depth + Manhattan distance]
-                neighbor.cheapest = neighbor.depth + manhattanDistance(neighbor.state);
-
-                neighbor.path = curr.path; // copy current path
-                neighbor.path.push_back(tempPath); // insert temp path into vector
-                aStarManhattan.push(neighbor);
-
-                // clear the vector and state data of this temp node to deallocate memory
-                neighbor.clear();
-                break;
-	}
-
-}
-
-// find and return integer representation of empty tile location
-int findEmpty(string state) {
-
-	//return empty "E" tile number
-	int number = 0;
-	for (unsigned int i = 0; i < state.length(); i++) {
-		if (state[i] == 'E') {
-			number = i + 1;
-		}
-		else {
-			// do nothing
-		}
-	}
-
-	switch (number) {
-	case 1: return 1;
-		break;
-	case 2: return 2;
-		break;
-	case 3: return 3;
-		break;
-	case 4: return 4;
-		break;
-	case 5: return 5;
-		break;
-	case 6: return 6;
-		break;
-	case 7: return 7;
-		break;
-	case 8: return 8;
-		break;
-	case 9: return 9;
-		break;
-	default: cout << "not a tile";
-		break;
-	}
-
-}
-
-// initiate search based on empty tile position
-void searchPattern(int tile, string workingState) {
-	switch (tile) {
-	case 1: tileOne(workingState);
-		break;
-	case 2: tileTwo(workingState);
-		break;
-	case 3: tileThree(workingState);
-		break;
-	case 4: tileFour(workingState);
-		break;
-	case 5: tileFive(workingState);
-		break;
-	case 6: tileSix(workingState);
-		break;
-	case 7: tileSeven(workingState);
-		break;
-	case 8: tileEight(workingState);
-		break;
-	case 9: tileNine(workingState);
-		break;
-	default: cout << "not a function";
-		break;
-	}
-}
-
-string bfs(string startState, char puzzle[ROW][COL]) {
-
-	// if the start state = the goal state, then the puzzle was not randomized/initialized, return error
-	if (startState == GOALSTATE) {
-		string error = "error";
-		return error;
-	}
-
-	dataStructure = 1; // initialize data structure (1 = queue)
-
-	insertMap(startState, counter); // install startState and counter into map
-
-	int startPoint = findEmpty(startState); // find & assign empty tile to an integer
-
-	Node e;  // create entrance node;
-
-	e.point = startPoint; // empty point in starting state
-	e.state = startState; // starting state
-	e.depth = 0; // depth of root
-	e.count = counter; // start count
-	e.path.push_back("Start, ");  // insert entry path into vector
-
-	bfsQueue.push(e); // enqueue entrance node
-
-	int workingPoint; // declare workingPoint int
-	string workingState;  // declare workingState string
-
-	// while queue is not empty
-	while (!bfsQueue.empty()) {
-		curr = bfsQueue.front();  // current node equals front of queue
-		workingPoint = curr.point; // assign workingPoint to current node value
-		workingState = curr.state; // assign workingState to current node value
-
-		// check for goal state, if it matches, return working state and exit the search
-		if (checkGoal(workingState)) {
-			return workingState;
-		}
-		else {
-			// do nothing
-		}
-
-		bfsQueue.pop();  // Else, dequeue the the front node and start the search
-
-		int emptyPoint = findEmpty(workingState); // find & assign empty tile to an integer
-
-		// begin search pattern based on empty tile position
-		searchPattern(emptyPoint, workingState);
-	}
-}
-
-string dfs(string startState, char puzzle[ROW][COL]) {
-
-	// if the start state = the goal state, then the puzzle was not randomized/initialized, return error
-	if (startState == GOALSTATE) {
-		return "error";
-	}
-
-	dataStructure = 2; // initialize data structure (2 = stack)
-
-	insertMap(startState, counter); // install startState and counter into map
-
-	int startPoint = findEmpty(startState); // find & assign empty tile
-
-	Node e;  // create entrance node;
-
-	e.point = startPoint; // empty point in starting state
-	e.state = startState; // starting state
-	e.depth = 0; // depth of root
-	e.count = counter; // start count
-	e.path.push_back("Start, ");  // insert entry path into vector
-
-	dfsStack.push(e); // push entrance node
-
-	int workingPoint; // declare workingPoint string
-	string workingState; // declare workingState string
-
-	// while stack is not empty
-	while (!dfsStack.empty()) {
-
-		curr = dfsStack.top();  // current node equals top of stack
-		workingPoint = curr.point; // assign workingPoint to current node value
-		workingState = curr.state; // assign workingState to current node value
-
-		// check for goal state, if it matches, return working state and exit the search
-		if (checkGoal(workingState)) {
-			return workingState;
-		}
-		else {
-			// do nothing
-		}
-			dfsStack.pop();  // Else, pop the the top node and start the search
-
-			int emptyPoint = findEmpty(workingState); // find & assign empty tile to an integer
-
-			// begin search pattern based on empty tile position
-			searchPattern(emptyPoint, workingState);
-	}
-}
-
-string oopl(string startState, char puzzle[ROW][COL]){
-
-    // if the start state = the goal state, then the puzzle was not randomized/initialized, return error
-	if (startState == GOALSTATE) {
-		return "error";
-	}
-
-	dataStructure = 3; // initialize data structure (3 = A* search w/ misplaced tiles)
-
-	insertMap(startState, counter); // install startState and counter into map
-
-	int startPoint = findEmpty(startState); // find & assign empty tile
-
-	Node e;  // create entrance node;
-
-	e.point = startPoint; // empty point in starting state
-	e.state = startState; // starting state
-	e.depth = 0; // depth of root
-	e.count = counter; // start count
-	e.path.push_back("Start, ");  // insert entry path into vector
-        e.cheapest = 0; // outOfPlace = misplaced tiles(0) + depth of node(0)
-
-	aStarOutofPlace.push(e); // push entrance node
-
-	int workingPoint; // declare workingPoint string
-	string workingState; // declare workingState string
-
-	// while stack is not empty
-	while (!aStarOutofPlace.empty()) {
-
-		curr = aStarOutofPlace.top();  // current node equals top of stack
-		workingPoint = curr.point; // assign workingPoint to current node value
-		workingState = curr.state; // assign workingState to current node value
-
-		// check for goal state, if it matches, return working state and exit the search
-		if (checkGoal(workingState)) {
-			return workingState;
-		}
-		else {
-			// do nothing
-		}
-			aStarOutofPlace.pop();  // Else, pop the the top node and start the search
-
-			int emptyPoint = findEmpty(workingState); // find & assign empty tile to an integer
-
-			// begin search pattern based on empty tile position
-			searchPattern(emptyPoint, workingState);
-	}
-}
-
-string mhttn(string startState, char puzzle[ROW][COL]){
-
-    // if the start state = the goal state, then the puzzle was not randomized/initialized, return error
-	if (startState == GOALSTATE) {
-		return "error";
-	}
-
-	dataStructure = 4; // initialize data structure (4 = A* search w/ manhattan distance)
-
-	insertMap(startState, counter); // install startState and counter into map
-
-	int startPoint = findEmpty(startState); // find & assign empty tile
-
-	Node e;  // create entrance node;
-
-	e.point = startPoint; // empty point in starting state
-	e.state = startState; // starting state
-	e.depth = 0; // depth of root
-	e.count = counter; // start count
-	e.path.push_back("Start, ");  // insert entry path into vector
-        e.cheapest = 0; // outOfPlace = misplaced tiles(0) + depth of node(0)
-
-	aStarManhattan.push(e); // push entrance node
-
-	int workingPoint; // declare workingPoint string
-	string workingState; // declare workingState string
-
-	// while stack is not empty
-	while (!aStarManhattan.empty()) {
-
-		curr = aStarManhattan.top();  // current node equals top of stack
-		workingPoint = curr.point; // assign workingPoint to current node value
-		workingState = curr.state; // assign workingState to current node value
-
-		// check for goal state, if it matches, return working state and exit the search
-		if (checkGoal(workingState)) {
-			return workingState;
-		}
-		else {
-			// do nothing
-		}
-			aStarManhattan.pop();  // Else, pop the the top node and start the search
-
-			int emptyPoint = findEmpty(workingState); // find & assign empty tile to an integer
-
-			// begin search pattern based on empty tile position
-			searchPattern(emptyPoint, workingState);
-	}
-}
-
-void results(string endState) {
-
-	// anything but the GOALSTATE results in an unsuccessful search
-	if (endState != GOALSTATE) {
-		cout << "Solution was not found" << endl;
-	}
-	else {
-		cout << "Search successful!" << endl;
-	}
-
-	// open a file
-	outFile.open("results.csv");
+	// open a file
+	outFile.open("results.csv");
 
 	// print results to console and the file
-	cout << "Starting State: " << startState << endl;
-	outFile << "Starting State: " << startState << endl;
-	cout << "Final State: " << curr.state << endl;
-	outFile << "Final State: " << curr.state << endl;
-	cout << "Search Depth: " << curr.depth << endl;
-	outFile << "Search Depth: " << curr.depth << endl;
-	cout << "Node Count: " << curr.count << endl;
-	outFile << "Node Count: " << curr.count << endl;
+	cout << "Starting State: " << result.startState << endl;
+	outFile << "Starting State: " << result.startState << endl;
+	cout << "Final State: " << result.finalState << endl;
+	outFile << "Final State: " << result.finalState << endl;
+	cout << "Search Depth: " << result.depth << endl;
+	outFile << "Search Depth: " << result.depth << endl;
+	cout << "Node Count: " << result.count << endl;
+	outFile << "Node Count: " << result.count << endl;
+	cout << "Nodes Expanded: " << result.stats.expanded << ", Generated: " << result.stats.generated
+		<< ", Duplicates: " << result.stats.duplicates << endl;
+	outFile << "Search Stats: " << statsCsvHeader() << endl;
+	outFile << "Search Stats: " << statsCsv(result.stats) << endl;
+	cout << "Peak Open List: " << result.stats.peakOpen << ", Peak Visited: " << result.stats.peakVisited
+		<< ", Bytes: " << result.stats.bytes << endl;
+	cout << "Search Time: " << result.stats.wallMicros[SEARCH] << " us (" << result.stats.cpuMicros[SEARCH]
+		<< " us CPU)" << endl;
 	cout << "See the (results.csv) file for search path" << endl;
 
+	// label each move, starting from the blank cell of the start state
+	vector<string> path;
+	path.push_back("Start, ");
+	int from = (int)result.startState.find('E'); // blank cell before each move
+	for (unsigned int m = 0; m < result.moves.size(); m++) {
+		path.push_back(P::moveLabel(from, result.moves[m]));
+		from = P::NEIGHBORS[from][result.moves[m]];
+	}
+
 	// iterate the path vector and write to the file
 	int i = 0;
 	vector<string>::iterator it;  // for loop list iterator
-	for (it = curr.path.begin(); it != curr.path.end(); ++it) {
+	for (it = path.begin(); it != path.end(); ++it) {
 		i++;
 		if (i % 25 == 0) {
 			outFile << endl;
@@ -0,0 +1,91 @@
+/* Slider Puzzle Mapped File
+*
+* See mapped_file.h.
+*
+* File:   mapped_file.cpp
+*/
+
+#include "mapped_file.h"
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+MappedFile::MappedFile() : mapping(NULL), length(0) {}
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+bool MappedFile::open(const string& fileName) {
+
+	close();
+
+#ifdef _WIN32
+	// no mmap here, read the file into memory once instead
+	ifstream file(fileName.c_str(), ios::binary | ios::ate);
+	if (!file) {
+		return false;
+	}
+	size_t fileSize = (size_t)file.tellg();
+	file.seekg(0);
+	buffer.reset(new uint8_t[fileSize]);
+	if (!file.read((char*)buffer.get(), fileSize)) {
+		buffer.reset();
+		return false;
+	}
+	mapping = buffer.get();
+#else
+	int fd = ::open(fileName.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		::close(fd);
+		return false;
+	}
+	size_t fileSize = (size_t)info.st_size;
+
+	void* view = mmap(NULL, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	mapping = (const uint8_t*)view;
+#endif
+
+	length = fileSize;
+	return true;
+}
+
+void MappedFile::close() {
+	if (mapping == NULL) {
+		return;
+	}
+
+#ifdef _WIN32
+	buffer.reset();
+#else
+	munmap((void*)mapping, length);
+#endif
+
+	mapping = NULL;
+	length = 0;
+}
+
+const uint8_t* MappedFile::data() const {
+	return mapping;
+}
+
+size_t MappedFile::size() const {
+	return length;
+}
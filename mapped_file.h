@@ -0,0 +1,52 @@
+/* Slider Puzzle Mapped File
+*
+* Read-only view of a whole table file. The file is memory-mapped (MAP_SHARED),
+* so every solver process on the host uses the same page cache copy; Windows
+* builds read the file into memory instead.
+*
+* File:   mapped_file.h
+*/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// read-only view of a file
+class MappedFile {
+public:
+
+	MappedFile();
+	~MappedFile();
+
+	// the mapping is released by the destructor, so the view cannot be copied
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// map a whole file read-only, replacing any open one, return false if it cannot be read
+	bool open(const std::string& fileName);
+
+	// release the mapping
+	void close();
+
+	// start of the file contents, NULL when closed
+	const uint8_t* data() const;
+
+	// file length in bytes
+	size_t size() const;
+
+private:
+
+	const uint8_t* mapping; // start of the mapped file, NULL when closed
+
+	size_t length; // mapped length in bytes
+
+#ifdef _WIN32
+	std::unique_ptr<uint8_t[]> buffer; // file contents, read in place of a mapping
+#endif
+};
+
+#endif
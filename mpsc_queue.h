@@ -0,0 +1,93 @@
+/* Slider Puzzle MPSC Queue
+*
+* Lock-free multi-producer, single-consumer queue for handing search nodes to
+* the thread that owns them. Producers collect items into a batch and push the
+* whole batch onto an atomic list head with compare-and-swap. The consumer
+* takes every queued batch at once with one exchange, so batches are never
+* popped one at a time and the list cannot suffer from ABA. Batches come out
+* newest first; the searches using it do not depend on arrival order.
+*
+* File:   mpsc_queue.h
+*/
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// items pushed together, linked to the batch pushed before it
+template <class T>
+struct MessageBatch {
+	MessageBatch* next = NULL; // next (older) batch in a taken list
+
+	std::vector<T> items; // items of this batch
+};
+
+// multi-producer, single-consumer list of batches
+template <class T>
+class MpscQueue {
+public:
+
+	typedef MessageBatch<T> Batch;
+
+	MpscQueue() = default;
+
+	// the queue owns the batches pushed onto it, it is not copied
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	// free any batch nobody took
+	~MpscQueue();
+
+	// hand a heap-allocated batch to the consumer, from any thread
+	void push(Batch* batch);
+
+	// take every queued batch, newest first, NULL if there is none (consumer only)
+	// The caller owns the returned batches and deletes them.
+	Batch* takeAll();
+
+	// free every queued batch (consumer only)
+	void clear();
+
+private:
+
+	// newest queued batch, NULL when empty
+	std::atomic<Batch*> head{ NULL };
+};
+
+template <class T>
+MpscQueue<T>::~MpscQueue() {
+	clear();
+}
+
+template <class T>
+void MpscQueue<T>::push(Batch* batch) {
+	batch->next = head.load(std::memory_order_relaxed);
+
+	// the release publishes the batch's items to the consumer's acquire
+	while (!head.compare_exchange_weak(batch->next, batch, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+}
+
+template <class T>
+typename MpscQueue<T>::Batch* MpscQueue<T>::takeAll() {
+
+	// a plain load first, an empty queue costs no write
+	if (head.load(std::memory_order_relaxed) == NULL) {
+		return NULL;
+	}
+	return head.exchange(NULL, std::memory_order_acquire);
+}
+
+template <class T>
+void MpscQueue<T>::clear() {
+	for (Batch* batch = takeAll(); batch != NULL; ) {
+		Batch* next = batch->next;
+		delete batch;
+		batch = next;
+	}
+}
+
+#endif
@@ -0,0 +1,263 @@
+/* Slider Puzzle Parallel IDA*
+*
+* Tree split, iterations and worker probes. See parallel_ida.h.
+*
+* File:   parallel_ida.cpp
+*/
+
+#include "parallel_ida.h"
+#include "heuristics.h"
+#include "work_queue.h"
+
+#include <climits>
+#include <thread>
+
+using namespace std;
+
+template <class P>
+template <class Heuristic>
+bool ParallelIda<P>::run(const Board& start, const Heuristic& heuristic, int threads, vector<int>& moves) {
+
+	if (threads < 1) {
+		threads = (int)thread::hardware_concurrency(); // one worker per core by default
+	}
+	if (threads < 1) {
+		threads = 1;
+	}
+
+	found = false;
+	bestMoves.clear();
+	totals = SearchStats();
+
+	// a goal above the split depth needs no iterations
+	bool above = split(start, heuristic, threads);
+	totals.bytes = units.capacity() * sizeof(Unit);
+	if (above) {
+		moves = bestMoves;
+		return true;
+	}
+
+	vector<WorkQueue> queues(threads);
+	vector<int> nextBound(threads); // smallest f over the bound per worker
+	vector<SearchStats> counts(threads); // counters per worker
+
+	// the first bound is the heuristic of the start state, each iteration raises it
+	// to the smallest f that went over the previous bound
+	int bound = heuristic.evaluate(start);
+	while (bound < PIDA_MAX_DEPTH) {
+
+		// deal the units out round-robin, stealing evens out the deep subtrees
+		for (int w = 0; w < threads; w++) {
+			queues[w].items.clear();
+		}
+		for (unsigned int i = 0; i < units.size(); i++) {
+			queues[i % threads].items.push_back(i);
+		}
+
+		auto work = [&](int w) {
+			Board board; // the one board this worker moves the blank around on
+			int path[PIDA_MAX_DEPTH]; // moves from the start state to board
+
+			nextBound[w] = INT_MAX;
+			counts[w] = SearchStats();
+			long long cpuStart = threadCpuMicros(); // the calling thread's time is charged by the Solver
+
+			int index;
+			while (!found.load(memory_order_relaxed) && takeWork(queues, w, index)) {
+				const Unit& unit = units[index];
+				board = unit.state;
+				for (int d = 0; d < unit.depth; d++) {
+					path[d] = unit.moves[d];
+				}
+
+				int lastMove = unit.depth > 0 ? unit.moves[unit.depth - 1] : -1;
+				int t = probe(heuristic, board, path, unit.depth, bound, lastMove, unit.h, counts[w]);
+				if (t < 0) {
+					break;
+				}
+				if (t < nextBound[w]) {
+					nextBound[w] = t;
+				}
+			}
+			if (w != 0) {
+				counts[w].cpuMicros[SEARCH] += threadCpuMicros() - cpuStart;
+			}
+		};
+
+		vector<thread> pool;
+		for (int w = 1; w < threads; w++) {
+			pool.push_back(thread(work, w));
+		}
+		work(0); // the calling thread is worker 0
+		for (unsigned int t = 0; t < pool.size(); t++) {
+			pool[t].join();
+		}
+
+		int next = INT_MAX;
+		long long peakPaths = 0;
+		for (int w = 0; w < threads; w++) {
+			totals.expanded += counts[w].expanded;
+			totals.generated += counts[w].generated;
+			totals.cpuMicros[SEARCH] += counts[w].cpuMicros[SEARCH];
+
+			// each worker holds one path at a time, all at once
+			peakPaths += counts[w].peakOpen;
+			if (nextBound[w] < next) {
+				next = nextBound[w];
+			}
+		}
+		SearchStats::raise(totals.peakOpen, peakPaths);
+
+		if (found) {
+			moves = bestMoves;
+			return true;
+		}
+		bound = next;
+	}
+
+	// no solution within the path buffer
+	return false;
+}
+
+template <class P>
+int ParallelIda<P>::nodes() const {
+	return (int)totals.generated;
+}
+
+template <class P>
+const SearchStats& ParallelIda<P>::stats() const {
+	return totals;
+}
+
+template <class P>
+template <class Heuristic>
+bool ParallelIda<P>::split(const Board& start, const Heuristic& heuristic, int threads) {
+
+	units.clear();
+	Unit root;
+	root.state = start;
+	root.h = heuristic.evaluate(start);
+	root.depth = 0;
+	units.push_back(root);
+
+	// expand the tree a whole level at a time until every worker gets enough units
+	// The levels go by depth, so a goal on one is an optimal path: no level above held one.
+	vector<Unit> level;
+	while (true) {
+		for (unsigned int i = 0; i < units.size(); i++) {
+			if (P::checkGoal(units[i].state)) {
+				bestMoves.assign(units[i].moves, units[i].moves + units[i].depth);
+				return true;
+			}
+		}
+
+		if ((int)units.size() >= threads * PIDA_UNITS_PER_WORKER || units[0].depth >= PIDA_MAX_SPLIT) {
+			return false;
+		}
+
+		level.clear();
+		for (unsigned int i = 0; i < units.size(); i++) {
+			const Unit& unit = units[i];
+			int lastMove = unit.depth > 0 ? unit.moves[unit.depth - 1] : -1;
+			totals.expanded++;
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[unit.state.blank][move];
+
+				// the blank cannot leave the board, and undoing the parent move only wastes a subtree
+				if (to < 0 || move == (lastMove ^ 2)) {
+					continue;
+				}
+
+				totals.generated++;
+
+				Unit child = unit;
+				child.state = P::slideBlank(unit.state, to);
+				child.h = heuristic.update(unit.h, child.state, P::tileAt(child.state, unit.state.blank),
+					to, unit.state.blank);
+				child.moves[unit.depth] = move;
+				child.depth = unit.depth + 1;
+				level.push_back(child);
+			}
+		}
+		units.swap(level);
+		SearchStats::raise(totals.peakOpen, units.size());
+	}
+}
+
+template <class P>
+template <class Heuristic>
+int ParallelIda<P>::probe(const Heuristic& heuristic, Board& board, int path[], int depth, int bound,
+	int lastMove, int h, SearchStats& counts) {
+
+	// another worker reached the goal under this bound, unwind
+	if (found.load(memory_order_relaxed)) {
+		return INT_MAX;
+	}
+
+	// f(n) = g(n) + h(n)
+	int f = depth + h;
+	if (f > bound) {
+		return f;
+	}
+
+	// the first goal reached is an optimal one, every shallower bound failed
+	if (P::checkGoal(board)) {
+		lock_guard<mutex> guard(bestLock);
+		if (!found) {
+			bestMoves.assign(path, path + depth);
+			found = true;
+		}
+		return -1;
+	}
+
+	int blank = board.blank; // blank cell to undo each move to
+	int next = INT_MAX; // smallest f over the bound below this node
+	counts.expanded++;
+	SearchStats::raise(counts.peakOpen, depth + 1); // only the current path is held
+	for (int move = RIGHT; move <= UP; move++) {
+		int to = P::NEIGHBORS[blank][move];
+
+		// the blank cannot leave the board, and undoing the parent move only wastes a probe
+		if (to < 0 || move == (lastMove ^ 2)) {
+			continue;
+		}
+
+		counts.generated++;
+
+		// make the move, probe below it, then unmake it
+		int tile = P::tileAt(board, to);
+		board = P::slideBlank(board, to);
+		path[depth] = move;
+
+		// h(n) of the child, the tile on "to" slid into the blank cell
+		int childH = heuristic.update(h, board, tile, to, blank);
+
+		int t = probe(heuristic, board, path, depth + 1, bound, move, childH, counts);
+		if (t < 0) {
+			return t;
+		}
+		board = P::slideBlank(board, blank);
+
+		if (t < next) {
+			next = t;
+		}
+	}
+	return next;
+}
+
+// the board sizes the program is built for, each w/ the heuristics of the serial IDA* searches
+template bool ParallelIda<Puzzle8>::run(const Puzzle8::Board&, const ManhattanPolicy<Puzzle8>&, int, vector<int>&);
+template bool ParallelIda<Puzzle8>::run(const Puzzle8::Board&, const LinearConflictPolicy<Puzzle8>&, int, vector<int>&);
+template bool ParallelIda<Puzzle8>::run(const Puzzle8::Board&, const WalkingDistancePolicy<Puzzle8>&, int, vector<int>&);
+template bool ParallelIda<Puzzle8>::run(const Puzzle8::Board&, const PatternPolicy<Puzzle8>&, int, vector<int>&);
+template bool ParallelIda<Puzzle15>::run(const Puzzle15::Board&, const ManhattanPolicy<Puzzle15>&, int, vector<int>&);
+template bool ParallelIda<Puzzle15>::run(const Puzzle15::Board&, const LinearConflictPolicy<Puzzle15>&, int, vector<int>&);
+template bool ParallelIda<Puzzle15>::run(const Puzzle15::Board&, const WalkingDistancePolicy<Puzzle15>&, int, vector<int>&);
+template bool ParallelIda<Puzzle15>::run(const Puzzle15::Board&, const PatternPolicy<Puzzle15>&, int, vector<int>&);
+template bool ParallelIda<Puzzle24>::run(const Puzzle24::Board&, const ManhattanPolicy<Puzzle24>&, int, vector<int>&);
+template bool ParallelIda<Puzzle24>::run(const Puzzle24::Board&, const LinearConflictPolicy<Puzzle24>&, int, vector<int>&);
+template bool ParallelIda<Puzzle24>::run(const Puzzle24::Board&, const WalkingDistancePolicy<Puzzle24>&, int, vector<int>&);
+template bool ParallelIda<Puzzle24>::run(const Puzzle24::Board&, const PatternPolicy<Puzzle24>&, int, vector<int>&);
+template class ParallelIda<Puzzle8>;
+template class ParallelIda<Puzzle15>;
+template class ParallelIda<Puzzle24>;
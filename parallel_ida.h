@@ -0,0 +1,99 @@
+/* Slider Puzzle Parallel IDA*
+*
+* Iterative-deepening A* over several worker threads. The search tree is split
+* once, at the shallowest depth that gives every worker a few dozen subtrees
+* (work units), and each iteration deals the units out through the
+* work-stealing queues (work_queue.h). A worker probes a unit's subtree below
+* the shared f bound exactly like the serial IDA* (same move table, same
+* heuristic policy, no move back to the parent), and the smallest f over the
+* bound across every unit becomes the next bound.
+*
+* Every earlier bound failed, so any goal found under the current bound is an
+* optimal one. The first worker to reach one raises a shared flag and every
+* other probe unwinds at its next node.
+*
+* File:   parallel_ida.h
+*/
+
+#ifndef PARALLEL_IDA_H
+#define PARALLEL_IDA_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "board.h"
+#include "search_stats.h"
+
+// longest path a parallel IDA* search can hold, as for the serial IDA*
+#define PIDA_MAX_DEPTH 256
+
+// deepest split of the search tree into work units
+#define PIDA_MAX_SPLIT 16
+
+// work units the split aims for per worker, so stealing can even out uneven subtrees
+#define PIDA_UNITS_PER_WORKER 32
+
+// the root of one subtree of the split
+template <class P>
+struct PidaUnit {
+
+	typename P::Board state; // state at the split depth
+
+	int h; // heuristic of the state
+
+	int depth; // moves from the start state
+
+	int moves[PIDA_MAX_SPLIT]; // Moves from the start state
+};
+
+// parallel IDA* search, reused between searches
+template <class P>
+class ParallelIda {
+public:
+
+	// packed state of the board size
+	typedef typename P::Board Board;
+
+	// search from a (solvable) start state w/ a heuristic policy on "threads" workers, 0 for one per core
+	// Write the moves of an optimal path and return true, or return false if no path fits PIDA_MAX_DEPTH.
+	template <class Heuristic>
+	bool run(const Board& start, const Heuristic& heuristic, int threads, std::vector<int>& moves);
+
+	// number of nodes the last search generated, the root not included
+	int nodes() const;
+
+	// counters of the split and every worker, and the CPU time of the workers but the calling thread
+	const SearchStats& stats() const;
+
+private:
+
+	typedef PidaUnit<P> Unit;
+
+	// split the tree below "start" into units, return true (w/ bestMoves set) if the goal lies above the split
+	template <class Heuristic>
+	bool split(const Board& start, const Heuristic& heuristic, int threads);
+
+	// search below one f bound from "board" (h = its heuristic), return the smallest f over the bound,
+	// -1 at the goal or INT_MAX once another worker found it
+	template <class Heuristic>
+	int probe(const Heuristic& heuristic, Board& board, int path[], int depth, int bound, int lastMove, int h,
+		SearchStats& counts);
+
+	// work units of the split, the same for every iteration
+	std::vector<Unit> units;
+
+	// set once a worker reaches the goal under the current bound
+	std::atomic<bool> found{ false };
+
+	// guards bestMoves
+	std::mutex bestLock;
+
+	// moves of the path found
+	std::vector<int> bestMoves;
+
+	// counters of the split and every worker
+	SearchStats totals;
+};
+
+#endif
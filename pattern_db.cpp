@@ -0,0 +1,305 @@
+/* Slider Puzzle Pattern Databases
+*
+* Building, storing and mapping pattern databases. See pattern_db.h.
+*
+* File:   pattern_db.cpp
+*/
+
+#include "pattern_db.h"
+#include "level_bfs.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+string patternFile(int rows, int cols) {
+	return "patterns" + to_string(rows) + "x" + to_string(cols) + ".pdb";
+}
+
+Partition defaultPartition(int rows, int cols) {
+
+	// the 4x4 board splits into two 6-tile blocks and the rest of the top row
+	if (rows == 4 && cols == 4) {
+		return { { 1, 5, 6, 9, 10, 13 }, { 7, 8, 11, 12, 14, 15 }, { 2, 3, 4 } };
+	}
+
+	// otherwise runs of consecutive tiles, tiles 1-4 and 5-8 on the 3x3 board and one row per pattern above
+	int size = rows * cols <= 9 ? 4 : cols;
+	Partition partition;
+	for (int tile = 1; tile < rows * cols; tile++) {
+		if ((tile - 1) % size == 0) {
+			partition.push_back(vector<int>());
+		}
+		partition.back().push_back(tile);
+	}
+	return partition;
+}
+
+// number of set bits below a cell in a mask of used cells
+static int usedBelow(uint32_t used, int cell) {
+	return __builtin_popcount(used & ((1u << cell) - 1));
+}
+
+PatternDatabase::PatternDatabase(int rows, int cols, const vector<int>& tiles)
+	: cols(cols), cells(rows * cols), tiles(tiles) {}
+
+size_t PatternDatabase::rankCells(const int where[], int count) const {
+	size_t rank = 0;
+	uint32_t used = 0; // cells taken by earlier entries
+	for (int i = 0; i < count; i++) {
+		rank = rank * (cells - i) + (where[i] - usedBelow(used, where[i]));
+		used |= 1u << where[i];
+	}
+	return rank;
+}
+
+void PatternDatabase::unrankCells(size_t rank, int count, int where[]) const {
+
+	// mixed radix digits, the last one varies fastest
+	int digit[MAX_PATTERN_TILES + 1];
+	for (int i = count - 1; i >= 0; i--) {
+		digit[i] = rank % (cells - i);
+		rank /= cells - i;
+	}
+
+	// each digit picks the digit-th cell not taken by an earlier entry
+	uint32_t used = 0;
+	for (int i = 0; i < count; i++) {
+		int cell = 0;
+		for (int skip = digit[i]; skip > 0 || (used >> cell) & 1; cell++) {
+			if (!((used >> cell) & 1)) {
+				skip--;
+			}
+		}
+		where[i] = cell;
+		used |= 1u << cell;
+	}
+}
+
+int PatternDatabase::manhattan(const int where[]) const {
+	int distance = 0;
+	for (unsigned int i = 0; i < tiles.size(); i++) {
+		int goal = tiles[i] - 1; // goal cell of the tile
+		distance += abs(where[i] / cols - goal / cols) + abs(where[i] % cols - goal % cols);
+	}
+	return distance;
+}
+
+size_t PatternDatabase::entryCount() const {
+	size_t count = 1;
+	for (unsigned int i = 0; i < tiles.size(); i++) {
+		count *= cells - i;
+	}
+	return count;
+}
+
+void PatternDatabase::attach(const uint8_t* entries) {
+	data = entries;
+}
+
+int PatternDatabase::lookup(const int where[]) const {
+	int place[MAX_PATTERN_TILES]; // cell of each pattern tile
+	for (unsigned int i = 0; i < tiles.size(); i++) {
+		place[i] = where[tiles[i]];
+	}
+
+	size_t rank = rankCells(place, tiles.size());
+	int away = (data[rank >> 1] >> ((rank & 1) * 4)) & 0xF;
+	return manhattan(place) + 2 * away;
+}
+
+vector<uint8_t> PatternDatabase::build() const {
+	int k = tiles.size();
+
+	// a search state is the k tile cells followed by the blank cell, ranked in
+	// mixed radix so that rank / (cells - k) is the rank of the tile placement
+	size_t states = entryCount() * (cells - k);
+
+	int start[MAX_PATTERN_TILES + 1]; // goal placement w/ the blank on the last cell
+	for (int i = 0; i < k; i++) {
+		start[i] = tiles[i] - 1;
+	}
+	start[k] = cells - 1;
+
+	// moves of the pattern's tiles to reach each state, a 0-1 BFS on all cores:
+	// blank moves cost nothing and stay on the level
+	LevelBfs bfs(states, 0);
+	vector<uint8_t> distance = bfs.run({ (uint32_t)rankCells(start, k + 1) },
+		[this, k](uint32_t rank, uint32_t child[], int cost[]) {
+			int place[MAX_PATTERN_TILES + 1];
+			unrankCells(rank, k + 1, place);
+
+			int blank = place[k];
+			int neighbors[4] = {
+				blank % cols + 1 < cols ? blank + 1 : -1,
+				blank + cols < cells ? blank + cols : -1,
+				blank % cols > 0 ? blank - 1 : -1,
+				blank - cols >= 0 ? blank - cols : -1
+			};
+
+			int count = 0;
+			for (int m = 0; m < 4; m++) {
+				int to = neighbors[m];
+				if (to < 0) {
+					continue;
+				}
+
+				// a pattern tile on "to" slides into the blank cell and the move counts
+				int moved = -1;
+				for (int i = 0; i < k; i++) {
+					if (place[i] == to) {
+						moved = i;
+					}
+				}
+
+				int next[MAX_PATTERN_TILES + 1];
+				memcpy(next, place, sizeof(int) * (k + 1));
+				next[k] = to;
+				if (moved >= 0) {
+					next[moved] = blank;
+				}
+
+				child[count] = (uint32_t)rankCells(next, k + 1);
+				cost[count] = moved >= 0 ? 1 : 0;
+				count++;
+			}
+			return count;
+		});
+
+	// the blank can be anywhere, keep the cheapest state of each tile placement
+	vector<uint8_t> entries((entryCount() + 1) / 2, 0);
+	for (size_t rank = 0; rank < entryCount(); rank++) {
+		int best = 0xFF;
+		for (int b = 0; b < cells - k; b++) {
+			if (distance[rank * (cells - k) + b] < best) {
+				best = distance[rank * (cells - k) + b];
+			}
+		}
+
+		// unrank the placement to take off its Manhattan part
+		int place[MAX_PATTERN_TILES];
+		unrankCells(rank, k, place);
+
+		// capping the away moves only lowers the value, so it stays admissible
+		int away = (best - manhattan(place)) / 2;
+		if (away > 15) {
+			away = 15;
+		}
+		entries[rank >> 1] |= (uint8_t)(away << ((rank & 1) * 4));
+	}
+	return entries;
+}
+
+bool PatternDatabaseSet::build(const string& fileName, int rows, int cols, const Partition& partition) {
+
+	PatternFileHeader header = { { 'S', 'P', 'P', 'D' }, PATTERN_VERSION, (uint32_t)rows, (uint32_t)cols,
+		(uint32_t)partition.size() };
+
+	// every pattern header first, so the loader can find each block
+	vector<PatternHeader> patternHeaders;
+	vector<vector<uint8_t> > blocks;
+	for (unsigned int p = 0; p < partition.size(); p++) {
+		if (partition[p].empty() || partition[p].size() > MAX_PATTERN_TILES) {
+			return false;
+		}
+
+		PatternDatabase pattern(rows, cols, partition[p]);
+		PatternHeader patternHeader = {};
+		patternHeader.tileCount = partition[p].size();
+		patternHeader.entries = pattern.entryCount();
+		for (unsigned int i = 0; i < partition[p].size(); i++) {
+			patternHeader.tiles[i] = (uint8_t)partition[p][i];
+		}
+		patternHeaders.push_back(patternHeader);
+		blocks.push_back(pattern.build());
+	}
+
+	ofstream database(fileName.c_str(), ios::binary | ios::trunc);
+	database.write((const char*)&header, sizeof(header));
+	database.write((const char*)patternHeaders.data(), sizeof(PatternHeader) * patternHeaders.size());
+	for (unsigned int p = 0; p < blocks.size(); p++) {
+		database.write((const char*)blocks[p].data(), blocks[p].size());
+	}
+	return (bool)database;
+}
+
+bool PatternDatabaseSet::open(const string& fileName, int rows, int cols) {
+
+	patterns.clear();
+	if (!file.open(fileName) || file.size() < sizeof(PatternFileHeader)) {
+		file.close();
+		return false;
+	}
+
+	// reject files from another version or board size
+	const PatternFileHeader* header = (const PatternFileHeader*)file.data();
+	if (memcmp(header->magic, "SPPD", 4) != 0 || header->version != PATTERN_VERSION
+		|| header->rows != (uint32_t)rows || header->cols != (uint32_t)cols
+		|| file.size() < sizeof(PatternFileHeader) + sizeof(PatternHeader) * header->patterns) {
+		file.close();
+		return false;
+	}
+
+	for (int t = 0; t < MAX_PATTERN_CELLS; t++) {
+		owner[t] = -1;
+	}
+
+	const PatternHeader* patternHeaders = (const PatternHeader*)(header + 1);
+	size_t offset = sizeof(PatternFileHeader) + sizeof(PatternHeader) * header->patterns;
+	for (uint32_t p = 0; p < header->patterns; p++) {
+
+		// the tiles must be real tiles of this board, each in one pattern only, before they index anything
+		uint32_t tileCount = patternHeaders[p].tileCount;
+		bool valid = tileCount <= MAX_PATTERN_TILES;
+		for (uint32_t i = 0; valid && i < tileCount; i++) {
+			int tile = patternHeaders[p].tiles[i];
+			valid = tile > 0 && tile < rows * cols && owner[tile] == -1;
+			if (valid) {
+				owner[tile] = p;
+			}
+		}
+		if (!valid) {
+			patterns.clear();
+			file.close();
+			return false;
+		}
+
+		vector<int> tiles(patternHeaders[p].tiles, patternHeaders[p].tiles + tileCount);
+		PatternDatabase pattern(rows, cols, tiles);
+
+		// the block must be the one this pattern builds and must fit in the file
+		size_t blockSize = (pattern.entryCount() + 1) / 2;
+		if (pattern.entryCount() != patternHeaders[p].entries || offset + blockSize > file.size()) {
+			patterns.clear();
+			file.close();
+			return false;
+		}
+
+		pattern.attach(file.data() + offset);
+		offset += blockSize;
+		patterns.push_back(pattern);
+	}
+	return true;
+}
+
+bool PatternDatabaseSet::isOpen() const {
+	return !patterns.empty();
+}
+
+int PatternDatabaseSet::evaluate(const int where[]) const {
+	int h = 0;
+	for (unsigned int p = 0; p < patterns.size(); p++) {
+		h += patterns[p].lookup(where);
+	}
+	return h;
+}
+
+int PatternDatabaseSet::evaluatePattern(int pattern, const int where[]) const {
+	return patterns[pattern].lookup(where);
+}
+
+int PatternDatabaseSet::patternOf(int tile) const {
+	return owner[tile];
+}
@@ -0,0 +1,132 @@
+/* Slider Puzzle Pattern Databases
+*
+* Additive disjoint pattern databases. The tiles are split into patterns, and
+* for each pattern a retrograde 0-1 BFS from the goal finds the fewest moves of
+* the pattern's own tiles that bring them home, for every placement of those
+* tiles (moves of the other tiles are free). The patterns share no tiles and
+* only count their own moves, so their values add up to an admissible h(n).
+*
+* Entries are nibble-packed. A pattern's value is its tiles' Manhattan distance
+* plus two moves per move away from the goal, so an entry stores that count of
+* away moves (capped at 15) and the Manhattan part is added back on lookup.
+*
+* File format: a PatternFileHeader, one PatternHeader per pattern, then each
+* pattern's nibble array in order. Files are memory-mapped read-only at startup.
+*
+* File:   pattern_db.h
+*/
+
+#ifndef PATTERN_DB_H
+#define PATTERN_DB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mapped_file.h"
+
+// pattern database format version
+#define PATTERN_VERSION 1
+
+// most tiles one pattern may hold
+#define MAX_PATTERN_TILES 8
+
+// most cells a board may have
+#define MAX_PATTERN_CELLS 32
+
+// header written in front of a pattern database file
+struct PatternFileHeader {
+	char magic[4]; // "SPPD"
+	uint32_t version; // PATTERN_VERSION
+	uint32_t rows; // board rows
+	uint32_t cols; // board columns
+	uint32_t patterns; // number of PatternHeaders that follow
+};
+
+// one pattern of a pattern database file
+struct PatternHeader {
+	uint32_t tileCount; // tiles in the pattern
+	uint32_t entries; // ranked placements of the tiles, two per byte
+	uint8_t tiles[MAX_PATTERN_TILES]; // tile values, unused slots 0
+};
+
+// the tiles of each pattern, e.g. { {1, 2, 3, 4}, {5, 6, 7, 8} }
+typedef std::vector<std::vector<int> > Partition;
+
+// pattern database file name of a rows x cols board ("patterns3x3.pdb")
+std::string patternFile(int rows, int cols);
+
+// default partition of a rows x cols board
+Partition defaultPartition(int rows, int cols);
+
+// read-only view of one pattern's entries
+class PatternDatabase {
+public:
+
+	// describe a pattern of a rows x cols board
+	PatternDatabase(int rows, int cols, const std::vector<int>& tiles);
+
+	// parallel retrograde 0-1 BFS from the goal (level_bfs.h), return the pattern's nibble-packed entries
+	std::vector<uint8_t> build() const;
+
+	// point the view at nibble-packed entries from build() or a mapped file
+	void attach(const uint8_t* entries);
+
+	// value of a placement: where[tile] is the cell of each tile (only the pattern's tiles are read)
+	int lookup(const int where[]) const;
+
+	// number of ranked placements of the pattern's tiles
+	size_t entryCount() const;
+
+private:
+
+	// rank distinct cells (the first "count" of them) in mixed radix n, n-1, ...
+	size_t rankCells(const int where[], int count) const;
+
+	// inverse of rankCells, write "count" cells
+	void unrankCells(size_t rank, int count, int where[]) const;
+
+	// Manhattan distance of the pattern's tiles on the given cells
+	int manhattan(const int cells[]) const;
+
+	int cols; // board columns
+	int cells; // rows * cols
+
+	std::vector<int> tiles; // tile values of the pattern
+
+	const uint8_t* data = NULL; // nibble-packed entries
+};
+
+// additive set of disjoint pattern databases for one board size
+class PatternDatabaseSet {
+public:
+
+	// build every pattern of a partition and write them to a file
+	static bool build(const std::string& fileName, int rows, int cols, const Partition& partition);
+
+	// memory-map a pattern database file for a rows x cols board, replacing any open one
+	bool open(const std::string& fileName, int rows, int cols);
+
+	// return true once a file is mapped
+	bool isOpen() const;
+
+	// sum of every pattern's value, where[tile] is the cell of each tile
+	int evaluate(const int where[]) const;
+
+	// value of one pattern, where[tile] is the cell of each tile
+	int evaluatePattern(int pattern, const int where[]) const;
+
+	// index of the pattern holding a tile
+	int patternOf(int tile) const;
+
+private:
+
+	MappedFile file; // the mapped pattern database file
+
+	std::vector<PatternDatabase> patterns; // views into the file
+
+	int owner[MAX_PATTERN_CELLS]; // pattern index of each tile value
+};
+
+#endif
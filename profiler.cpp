@@ -0,0 +1,112 @@
+/* Slider Puzzle Profiler
+*
+* Per-thread tables, tick calibration and the exit summary. See profiler.h.
+*
+* File:   profiler.cpp
+*/
+
+#include "profiler.h"
+
+#ifdef SLIDER_PROFILE
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+// every thread's table, kept past the thread's end for the summary
+static mutex tablesLock;
+static vector<ProfileTable*> tables;
+
+// ticks and steady clock at the first registration, to convert ticks to time at exit
+static uint64_t startTicks;
+static chrono::steady_clock::time_point startTime;
+
+// smallest tick count of the histogram bucket holding the given share of the timed calls
+static uint64_t histogramPercentile(const ProfileCounter& counter, double share) {
+	uint64_t seen = 0;
+	for (int b = 0; b < PROFILE_BUCKETS; b++) {
+		seen += counter.histogram[b];
+		if (seen > 0 && seen >= share * counter.sampled) {
+			return (uint64_t)1 << b;
+		}
+	}
+	return 0;
+}
+
+// merge every thread's table and print one line per point
+static void printSummary() {
+	const char* names[PROFILE_POINTS] = { "pop", "generate", "heuristic", "push" };
+
+	lock_guard<mutex> guard(tablesLock);
+
+	// ticks per nanosecond over the whole run
+	double nanos = (double)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - startTime).count();
+	double ticksPerNano = nanos > 0 ? (profileTicks() - startTicks) / nanos : 1;
+
+	ProfileCounter total[PROFILE_POINTS] = {};
+	uint64_t iterations = 0;
+	uint64_t timed = 0;
+	for (unsigned int t = 0; t < tables.size(); t++) {
+		iterations += tables[t]->iterations;
+		timed += tables[t]->timed;
+		for (int p = 0; p < PROFILE_POINTS; p++) {
+			const ProfileCounter& counter = tables[t]->counters[p];
+			total[p].sampled += counter.sampled;
+			total[p].ticks += counter.ticks;
+			for (int b = 0; b < PROFILE_BUCKETS; b++) {
+				total[p].histogram[b] += counter.histogram[b];
+			}
+		}
+	}
+
+	// each point's time, scaled from the timed iterations to all of them
+	double scale = timed > 0 ? (double)iterations / timed : 0;
+	double estimate[PROFILE_POINTS] = {};
+	double all = 0;
+	for (int p = 0; p < PROFILE_POINTS; p++) {
+		estimate[p] = total[p].ticks * scale;
+		all += estimate[p];
+	}
+
+	fprintf(stderr, "\nprofile: %u thread(s), %llu iterations, 1 in %d timed, %.2f ticks/ns\n",
+		(unsigned int)tables.size(), (unsigned long long)iterations, PROFILE_SAMPLE_EVERY, ticksPerNano);
+	fprintf(stderr, "%-10s %14s %12s %10s %10s %12s %7s\n", "point", "timed calls", "mean ticks", "p50 <", "p99 <",
+		"est. ms", "share");
+	for (int p = 0; p < PROFILE_POINTS; p++) {
+		if (total[p].sampled == 0) {
+			continue;
+		}
+		double mean = (double)total[p].ticks / total[p].sampled;
+		fprintf(stderr, "%-10s %14llu %12.1f %10llu %10llu %12.1f %6.1f%%\n", names[p],
+			(unsigned long long)total[p].sampled, mean,
+			(unsigned long long)histogramPercentile(total[p], 0.5) * 2,
+			(unsigned long long)histogramPercentile(total[p], 0.99) * 2,
+			estimate[p] / ticksPerNano / 1e6, all > 0 ? estimate[p] * 100 / all : 0);
+	}
+}
+
+void profileRecord(ProfileCounter& counter, uint64_t start) {
+	uint64_t ticks = profileTicks() - start;
+	counter.sampled++;
+	counter.ticks += ticks;
+	counter.histogram[ticks != 0 ? 63 - __builtin_clzll(ticks) : 0]++;
+}
+
+ProfileTable* registerProfileTable() {
+	ProfileTable* table = new ProfileTable(); // zeroed, and never freed: the summary reads it at exit
+
+	lock_guard<mutex> guard(tablesLock);
+	if (tables.empty()) {
+		startTicks = profileTicks();
+		startTime = chrono::steady_clock::now();
+		atexit(printSummary);
+	}
+	tables.push_back(table);
+	return table;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/* Slider Puzzle Profiler
+*
+* Scoped timers on the hot paths of the BFS, DFS and A* searches, once per
+* loop iteration: taking the next node off the open list, generating its
+* children and checking them against the visited set, the heuristic of the
+* children, and storing and queuing them. The profiler is compiled in w/
+* -DSLIDER_PROFILE only. Without it every PROFILE_ macro expands to nothing
+* and profiler.cpp is empty.
+*
+* A search fetches its thread's table once (PROFILE_SEARCH) and counts its
+* loop iterations in a local sampler (PROFILE_NEXT). One iteration in
+* PROFILE_SAMPLE_EVERY is timed: each scope in it reads the time stamp
+* counter (rdtsc, a steady clock off x86) when it opens and closes. In the
+* other iterations a scope only tests the sampler's flag, so the untimed path
+* touches no memory. The timed durations go into a log2 histogram per point
+* in a per-thread table, so no timer touches shared memory. At exit the
+* tables of every thread are merged and a summary goes to stderr: timed calls,
+* mean and percentile ticks, and the estimated time and share of each point,
+* scaled from the timed iterations to all of them.
+*
+* File:   profiler.h
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifdef SLIDER_PROFILE
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// one timed loop iteration in this many per search, a power of 2
+#ifndef PROFILE_SAMPLE_EVERY
+#define PROFILE_SAMPLE_EVERY 64
+#endif
+
+// log2 buckets of the duration histograms, up to 2^63 ticks
+#define PROFILE_BUCKETS 64
+
+// instrumentation points of the search loops
+enum ProfilePoint {
+	PROFILE_POP, // take the next node off the queue, stack or open list
+	PROFILE_GENERATE, // build the children of a node and check them against the visited set
+	PROFILE_HEURISTIC, // evaluate the heuristic of the children
+	PROFILE_PUSH, // store the new children and queue them
+	PROFILE_POINTS
+};
+
+// timed calls of one point on one thread
+struct ProfileCounter {
+
+	uint64_t sampled; // calls that were timed
+
+	uint64_t ticks; // total ticks of the timed calls
+
+	uint64_t histogram[PROFILE_BUCKETS]; // timed calls by floor(log2(ticks))
+};
+
+// counters of every point on one thread, owned by the profiler until exit
+struct ProfileTable {
+	ProfileCounter counters[PROFILE_POINTS];
+
+	uint64_t iterations; // search loop iterations
+
+	uint64_t timed; // iterations whose scopes were timed
+};
+
+// register a table for the calling thread (and schedule the exit summary on the first)
+ProfileTable* registerProfileTable();
+
+// the calling thread's table, registered on first use
+inline ProfileTable& profileTable() {
+	static thread_local ProfileTable* table = NULL; // constant initialized, so no guard on the hot path
+	if (table == NULL) {
+		table = registerProfileTable();
+	}
+	return *table;
+}
+
+// current time stamp counter
+inline uint64_t profileTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// add one timed call that opened at "start" to a counter, kept out of line so the untimed path stays small
+__attribute__((noinline, cold)) void profileRecord(ProfileCounter& counter, uint64_t start);
+
+// picks the timed iterations of one search loop, and adds its iteration counts to the thread's table at the end
+class ProfileSampler {
+public:
+
+	ProfileSampler() : table(&profileTable()) {}
+
+	~ProfileSampler() {
+		table->iterations += iterations;
+		table->timed += iterations / PROFILE_SAMPLE_EVERY;
+	}
+
+	ProfileSampler(const ProfileSampler&) = delete;
+	ProfileSampler& operator=(const ProfileSampler&) = delete;
+
+	// start the next loop iteration
+	void next() {
+		timing = (++iterations & (PROFILE_SAMPLE_EVERY - 1)) == 0;
+	}
+
+	ProfileTable* table; // the searching thread's table
+
+	uint64_t iterations = 0; // loop iterations so far
+
+	bool timing = false; // the current iteration is timed
+};
+
+// times the enclosing block when the sampler's current iteration is timed
+class ProfileScope {
+public:
+
+	ProfileScope(const ProfileSampler& sampler, ProfilePoint point) : sampler(sampler), point(point) {
+		start = __builtin_expect(sampler.timing, 0) ? profileTicks() : 0;
+	}
+
+	~ProfileScope() {
+		if (__builtin_expect(start != 0, 0)) {
+			profileRecord(sampler.table->counters[point], start);
+		}
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+
+	const ProfileSampler& sampler; // the search's sampler
+
+	ProfilePoint point; // the point timed
+
+	uint64_t start; // ticks when the scope opened, 0 if the iteration is not timed
+};
+
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+
+// declare the sampler of one search loop, fetching the thread's table once
+#define PROFILE_SEARCH(sampler) ProfileSampler sampler
+
+// start the next iteration of the search loop
+#define PROFILE_NEXT(sampler) (sampler).next()
+
+// time the rest of the enclosing block as one call of a point, in the iterations the sampler times
+#define PROFILE_SCOPE(sampler, point) ProfileScope PROFILE_JOIN(profileScope, __LINE__)((sampler), (point))
+
+#else
+
+// the profiler is compiled out
+#define PROFILE_SEARCH(sampler)
+#define PROFILE_NEXT(sampler)
+#define PROFILE_SCOPE(sampler, point)
+
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/* Slider Puzzle Search Stats
+*
+* Merging, clocks and the CSV and JSON export. See search_stats.h.
+*
+* File:   search_stats.cpp
+*/
+
+#include "search_stats.h"
+
+#include <chrono>
+#include <sstream>
+#include <ctime>
+
+using namespace std;
+
+void SearchStats::merge(const SearchStats& other) {
+	expanded += other.expanded;
+	generated += other.generated;
+	duplicates += other.duplicates;
+	raise(peakOpen, other.peakOpen);
+	raise(peakVisited, other.peakVisited);
+	bytes += other.bytes;
+	cacheHits += other.cacheHits;
+	cacheMisses += other.cacheMisses;
+	for (int p = 0; p < PHASE_COUNT; p++) {
+		raise(wallMicros[p], other.wallMicros[p]); // the workers ran side by side
+		cpuMicros[p] += other.cpuMicros[p];
+	}
+}
+
+PhaseClock PhaseClock::now() {
+	PhaseClock clock;
+	clock.wall = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+	clock.cpu = threadCpuMicros();
+	return clock;
+}
+
+PhaseClock PhaseClock::charge(SearchStats& stats, SearchPhase phase) const {
+	PhaseClock end = now();
+	stats.wallMicros[phase] += end.wall - wall;
+	stats.cpuMicros[phase] += end.cpu - cpu;
+	return end;
+}
+
+long long threadCpuMicros() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	timespec time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return (long long)time.tv_sec * 1000000 + time.tv_nsec / 1000;
+#else
+	return 0; // no per-thread CPU clock, the CPU columns stay 0
+#endif
+}
+
+string phaseName(SearchPhase phase) {
+	const char* names[] = { "setup", "search", "path" };
+	return names[phase];
+}
+
+string statsCsvHeader() {
+	stringstream header;
+	header << "expanded,generated,duplicates,peak_open,peak_visited,bytes,cache_hits,cache_misses";
+	for (int p = 0; p < PHASE_COUNT; p++) {
+		header << ',' << phaseName((SearchPhase)p) << "_wall_us," << phaseName((SearchPhase)p) << "_cpu_us";
+	}
+	return header.str();
+}
+
+string statsCsv(const SearchStats& stats) {
+	stringstream row;
+	row << stats.expanded << ',' << stats.generated << ',' << stats.duplicates << ',' << stats.peakOpen << ','
+		<< stats.peakVisited << ',' << stats.bytes << ',' << stats.cacheHits << ',' << stats.cacheMisses;
+	for (int p = 0; p < PHASE_COUNT; p++) {
+		row << ',' << stats.wallMicros[p] << ',' << stats.cpuMicros[p];
+	}
+	return row.str();
+}
+
+string statsJson(const SearchStats& stats) {
+	stringstream object;
+	object << "{\"expanded\":" << stats.expanded << ",\"generated\":" << stats.generated
+		<< ",\"duplicates\":" << stats.duplicates << ",\"peak_open\":" << stats.peakOpen
+		<< ",\"peak_visited\":" << stats.peakVisited << ",\"bytes\":" << stats.bytes
+		<< ",\"cache_hits\":" << stats.cacheHits << ",\"cache_misses\":" << stats.cacheMisses;
+	for (int p = 0; p < PHASE_COUNT; p++) {
+		object << ",\"" << phaseName((SearchPhase)p) << "_wall_us\":" << stats.wallMicros[p]
+			<< ",\"" << phaseName((SearchPhase)p) << "_cpu_us\":" << stats.cpuMicros[p];
+	}
+	object << "}";
+	return object.str();
+}
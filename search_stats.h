@@ -0,0 +1,96 @@
+/* Slider Puzzle Search Stats
+*
+* Counters every search fills in, returned w/ each SolveResult: nodes expanded
+* and generated, children rejected as duplicates, the peak open list and
+* visited set sizes, the bytes held by the search storage, the solution cache
+* lookups that hit or missed, and the wall and CPU time of each phase of the
+* solve. The CPU time of a phase adds up every thread that worked on it, so a
+* parallel search can report more CPU than wall time. CPU time comes from the
+* POSIX per-thread clock (CLOCK_THREAD_CPUTIME_ID); where the platform has
+* none it reads 0.
+*
+* The stats export as one CSV row (statsCsvHeader() names the columns) or one
+* JSON object, for the batch records (batch.h) or any embedding program.
+*
+* File:   search_stats.h
+*/
+
+#ifndef SEARCH_STATS_H
+#define SEARCH_STATS_H
+
+#include <string>
+
+// phases of one solve
+enum SearchPhase {
+	SETUP, // validation, packing, the reset of the search storage and the solution cache lookup
+	SEARCH, // the search itself, up to the final node
+	PATH, // rebuilding the path and filling in the result
+	PHASE_COUNT
+};
+
+// counters and timings of one search
+struct SearchStats {
+
+	long long expanded = 0; // nodes whose children were generated
+
+	long long generated = 0; // children generated, duplicates included
+
+	long long duplicates = 0; // children dropped because their state was already reached as cheaply
+
+	long long peakOpen = 0; // most nodes waiting on the open list (queue, stack, frontier or path) at once, the sum of the per-worker peaks for HDA*
+
+	long long peakVisited = 0; // most states held by the visited set at once
+
+	long long bytes = 0; // bytes held by the node pool, open lists and visited set at the end of the search
+
+	long long cacheHits = 0; // solution cache lookups that returned a stored solution
+
+	long long cacheMisses = 0; // solution cache lookups that found nothing, so the search ran
+
+	long long wallMicros[PHASE_COUNT] = {}; // wall time of each phase
+
+	long long cpuMicros[PHASE_COUNT] = {}; // CPU time of each phase, over every thread
+
+	// raise a peak to "size" if it is larger
+	static void raise(long long& peak, long long size) {
+		if (size > peak) {
+			peak = size;
+		}
+	}
+
+	// add the counts, bytes and CPU time of another worker's stats, and keep the larger peak and wall time of each
+	// Workers run at the same time, so their wall times overlap. A caller that
+	// knows its workers peak at once adds up their peaks itself.
+	void merge(const SearchStats& other);
+};
+
+// wall and CPU clock readings of the calling thread, for timing one phase
+struct PhaseClock {
+
+	long long wall; // steady clock, in microseconds
+
+	long long cpu; // CPU time of the calling thread, in microseconds
+
+	// read both clocks
+	static PhaseClock now();
+
+	// add the time since this reading to a phase, return the reading taken now
+	PhaseClock charge(SearchStats& stats, SearchPhase phase) const;
+};
+
+// CPU time of the calling thread in microseconds, 0 on platforms w/o a per-thread CPU clock
+long long threadCpuMicros();
+
+// name of a phase ("setup", "search", "path")
+std::string phaseName(SearchPhase phase);
+
+// column names of statsCsv(), comma-separated w/o a line end
+std::string statsCsvHeader();
+
+// the stats as one comma-separated row w/o a line end
+std::string statsCsv(const SearchStats& stats);
+
+// the stats as one JSON object
+std::string statsJson(const SearchStats& stats);
+
+#endif
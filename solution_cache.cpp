@@ -0,0 +1,178 @@
+/* Slider Puzzle Solution Cache
+*
+* LRU bookkeeping and the log replay. See solution_cache.h.
+*
+* File:   solution_cache.cpp
+*/
+
+#include "solution_cache.h"
+#include "algorithm.h"
+#include "state_set.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <sstream>
+
+using namespace std;
+
+// return true if the RDLU path slides the packed start of a P board to the goal
+template <class P>
+static bool reachesGoal(unsigned __int128 tiles, const string& path) {
+	typename P::Board board;
+	board.tiles = (typename P::Tiles)tiles;
+	if ((unsigned __int128)board.tiles != tiles) {
+		return false;
+	}
+
+	board.blank = -1;
+	for (int cell = 0; cell < P::CELLS; cell++) {
+		if (P::tileAt(board, cell) == 0) {
+			board.blank = cell;
+		}
+	}
+	if (board.blank < 0) {
+		return false;
+	}
+
+	for (unsigned int m = 0; m < path.size(); m++) {
+		int to = P::NEIGHBORS[board.blank][string("RDLU").find(path[m])];
+		if (to < 0) {
+			return false;
+		}
+		board = P::slideBlank(board, to);
+	}
+	return P::checkGoal(board);
+}
+
+// return true if the path of a record solves its start state
+static bool validRecord(const CacheKey& key, const string& path) {
+	switch (key.cells) {
+	case Puzzle8::CELLS:
+		return reachesGoal<Puzzle8>(key.tiles, path);
+	case Puzzle15::CELLS:
+		return reachesGoal<Puzzle15>(key.tiles, path);
+	case Puzzle24::CELLS:
+		return reachesGoal<Puzzle24>(key.tiles, path);
+	default:
+		return false;
+	}
+}
+
+size_t CacheKeyHash::operator()(const CacheKey& key) const {
+	return TilesHash()(key.tiles) ^ ((size_t)key.cells << 8 | (size_t)key.algorithm) * 0x9E3779B97F4A7C15ULL;
+}
+
+SolutionCache::SolutionCache(size_t capacity) : capacity(capacity > 0 ? capacity : 1) {
+}
+
+bool SolutionCache::openLog(const string& fileName) {
+	lock_guard<mutex> guard(lock);
+
+	if (log.is_open()) {
+		log.close();
+	}
+
+	// replay every record, a record that does not parse or whose path does not solve its start state is skipped
+	ifstream replay(fileName.c_str());
+	string line;
+	while (getline(replay, line)) {
+		stringstream fields(line);
+		CacheKey key;
+		string version, name, hex, path;
+		int depth;
+		Algorithm algorithm;
+		if (!(fields >> version >> key.cells >> name >> hex >> depth) || version != "v" + to_string(SOLUTION_CACHE_VERSION)
+			|| !parseAlgorithm(name, algorithm) || hex.size() != 32) {
+			continue;
+		}
+		fields >> path; // empty for a start state that is the goal
+		if ((int)path.size() != depth || path.find_first_not_of("RDLU") != string::npos) {
+			continue;
+		}
+
+		unsigned long long high, low;
+		if (sscanf(hex.c_str(), "%16llx%16llx", &high, &low) != 2) {
+			continue;
+		}
+		key.tiles = (unsigned __int128)high << 64 | low;
+		key.algorithm = algorithm;
+		if (!validRecord(key, path)) {
+			continue;
+		}
+		store(key, depth, path);
+	}
+
+	log.open(fileName.c_str(), ios::app);
+	return log.is_open();
+}
+
+void SolutionCache::closeLog() {
+	lock_guard<mutex> guard(lock);
+	log.close();
+}
+
+bool SolutionCache::find(const CacheKey& key, int& depth, string& path) {
+	lock_guard<mutex> guard(lock);
+
+	auto entry = index.find(key);
+	if (entry == index.end()) {
+		missCount++;
+		return false;
+	}
+
+	// most recently used first
+	order.splice(order.begin(), order, entry->second);
+	depth = entry->second->depth;
+	path = entry->second->path;
+	hitCount++;
+	return true;
+}
+
+void SolutionCache::insert(const CacheKey& key, int depth, const string& path) {
+	lock_guard<mutex> guard(lock);
+	store(key, depth, path);
+
+	if (log.is_open()) {
+		char hex[33];
+		snprintf(hex, sizeof(hex), "%016llx%016llx", (unsigned long long)(uint64_t)(key.tiles >> 64),
+			(unsigned long long)(uint64_t)key.tiles);
+		log << 'v' << SOLUTION_CACHE_VERSION << ' ' << key.cells << ' ' << algorithmName((Algorithm)key.algorithm) << ' ' << hex << ' ' << depth << ' ' << path << '\n';
+		log.flush();
+	}
+}
+
+void SolutionCache::store(const CacheKey& key, int depth, const string& path) {
+
+	// a stored key only moves to the front w/ its new solution
+	auto entry = index.find(key);
+	if (entry != index.end()) {
+		entry->second->depth = depth;
+		entry->second->path = path;
+		order.splice(order.begin(), order, entry->second);
+		return;
+	}
+
+	order.push_front(Entry{ key, depth, path });
+	index[key] = order.begin();
+
+	// evict the least recently used past the capacity
+	if (order.size() > capacity) {
+		index.erase(order.back().key);
+		order.pop_back();
+	}
+}
+
+size_t SolutionCache::size() const {
+	lock_guard<mutex> guard(lock);
+	return order.size();
+}
+
+long long SolutionCache::hits() const {
+	lock_guard<mutex> guard(lock);
+	return hitCount;
+}
+
+long long SolutionCache::misses() const {
+	lock_guard<mutex> guard(lock);
+	return missCount;
+}
@@ -0,0 +1,118 @@
+/* Slider Puzzle Solution Cache
+*
+* Solved start states keyed by board size, algorithm and packed start tiles,
+* so a repeated start state returns its stored depth and path without a
+* search. Solvers key and store the canonical start state (board.h) and the
+* path from it, so a state and its mirror share one entry. The cache sits in
+* front of every algorithm through SolveOptions and is shared between
+* Solvers, one lock guards it. The in-memory tier holds at most "capacity"
+* solutions and evicts the least recently used one first.
+*
+* An optional log file makes the cache persistent: openLog() replays every
+* record of the file into the memory tier (later records win, the oldest fall
+* out past the capacity), then every new solution is appended to it. A record
+* is one text line, "v<version> <cells> <algorithm> <tiles> <depth> <path>",
+* where tiles is the packed start as 32 hex digits and path is the compact RDLU
+* path. Lines that do not parse, such as one cut short by a crash, records of
+* another version, and records whose path does not take the start state to
+* the goal in "depth" moves are skipped.
+*
+* File:   solution_cache.h
+*/
+
+#ifndef SOLUTION_CACHE_H
+#define SOLUTION_CACHE_H
+
+#include <cstddef>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// solutions kept in memory by default
+#define SOLUTION_CACHE_SIZE 65536
+
+// log record version, records of older versions were keyed by the raw start state
+#define SOLUTION_CACHE_VERSION 2
+
+// what a cached solution is keyed by
+struct CacheKey {
+
+	unsigned __int128 tiles; // packed canonical start tiles, widened to 128 bits
+
+	int cells; // cells of the board, the blank included
+
+	int algorithm; // Algorithm that solved it
+
+	bool operator==(const CacheKey& other) const {
+		return tiles == other.tiles && cells == other.cells && algorithm == other.algorithm;
+	}
+};
+
+// hash of a cache key
+struct CacheKeyHash {
+	size_t operator()(const CacheKey& key) const;
+};
+
+// bounded LRU cache of solutions w/ an optional append-only log, shared between threads
+class SolutionCache {
+public:
+
+	// keep at most "capacity" solutions in memory (at least 1)
+	explicit SolutionCache(size_t capacity = SOLUTION_CACHE_SIZE);
+
+	// the cache owns its log stream and lock, it is not copied
+	SolutionCache(const SolutionCache&) = delete;
+	SolutionCache& operator=(const SolutionCache&) = delete;
+
+	// replay a log file into memory, then append new solutions to it, replacing any open log
+	// Return false if the file cannot be opened for appending.
+	bool openLog(const std::string& fileName);
+
+	// stop appending to the log
+	void closeLog();
+
+	// write the depth and path of a cached solution and mark it most recently used, return false on a miss
+	bool find(const CacheKey& key, int& depth, std::string& path);
+
+	// store a solution as most recently used, evicting the least recently used past the capacity, and log it
+	void insert(const CacheKey& key, int depth, const std::string& path);
+
+	// number of solutions in memory
+	size_t size() const;
+
+	// lookups that found a solution, and lookups that did not
+	long long hits() const;
+	long long misses() const;
+
+private:
+
+	// one cached solution
+	struct Entry {
+		CacheKey key;
+
+		int depth; // number of moves
+
+		std::string path; // one RDLU letter per blank move
+	};
+
+	// store an entry without logging it, the lock must be held
+	void store(const CacheKey& key, int depth, const std::string& path);
+
+	size_t capacity; // most solutions kept in memory
+
+	mutable std::mutex lock; // guards everything below
+
+	std::list<Entry> order; // solutions, most recently used first
+
+	std::unordered_map<CacheKey, std::list<Entry>::iterator, CacheKeyHash> index; // where each key sits in order
+
+	std::ofstream log; // open log file, appended to on insert
+
+	long long hitCount = 0;
+
+	long long missCount = 0;
+};
+
+#endif
@@ -0,0 +1,792 @@
+/* Slider Puzzle Solver
+*
+* Search methods behind the Solver API. See solver.h.
+*
+* File:   solver.cpp
+*/
+
+#include "solver.h"
+#include "heuristics.h"
+#include "profiler.h"
+
+#include <climits>
+#include <type_traits>
+
+using namespace std;
+
+string SolveResult::compactPath() const {
+	string path(moves.size(), ' ');
+	for (unsigned int m = 0; m < moves.size(); m++) {
+		path[m] = "RDLU"[moves[m]];
+	}
+	return path;
+}
+
+string statusName(SolveStatus status) {
+	const char* names[] = { "solved", "not found", "unsolvable", "invalid" };
+	return names[status];
+}
+
+template <class P>
+SolveResult Solver<P>::solve(const string& start, Algorithm algorithm, const SolveOptions& options) {
+
+	PhaseClock clock = PhaseClock::now();
+
+	// forget the previous search
+	reset();
+
+	SolveResult result;
+	result.startState = start;
+
+	// reject malformed states before packing them
+	if (!P::validState(start)) {
+		return withStats(result, clock, SETUP);
+	}
+
+	Board startState = P::packState(start);
+	result.finalState = start;
+
+	// the database algorithms need their database open, the distance database only covers 3x3
+	if (algorithm == DB && (!is_same<P, Puzzle8>::value || options.database == NULL || !options.database->isOpen())) {
+		return withStats(result, clock, SETUP);
+	}
+	if ((algorithm == PDB || algorithm == IDA_PDB || algorithm == PIDA_PDB) && (options.patterns == NULL || !options.patterns->isOpen())) {
+		return withStats(result, clock, SETUP);
+	}
+
+	// the walking distance tables only cover boards up to 4x4
+	if ((algorithm == WD || algorithm == IDA_WD || algorithm == PIDA_WD) && !hasWalkingDistance<P>()) {
+		return withStats(result, clock, SETUP);
+	}
+
+	// the other half of the states can never reach the goal, no need to search them
+	if (!P::isSolvableState(startState)) {
+		result.status = UNSOLVABLE;
+		return withStats(result, clock, SETUP);
+	}
+
+	// already solved, nothing to search
+	if (P::checkGoal(startState)) {
+		result.status = SOLVED;
+		result.depth = 0;
+		result.count = counter;
+		return withStats(result, clock, SETUP);
+	}
+
+	// a start state solved before returns its stored solution without a search
+	// The cache holds the canonical start state, w/ the path from it.
+	if (options.cache != NULL) {
+		bool mirrored;
+		CacheKey key = { (unsigned __int128)P::canonicalState(startState, mirrored).tiles, P::CELLS, algorithm };
+		string path;
+		if (options.cache->find(key, result.depth, path)) {
+			stats.cacheHits++;
+			result.status = SOLVED;
+			result.finalState = P::goalString();
+			result.count = counter;
+			for (unsigned int m = 0; m < path.size(); m++) {
+				int move = (int)string("RDLU").find(path[m]);
+				result.moves.push_back(mirrored ? mirrorMove(move) : move);
+			}
+			return withStats(result, clock, SETUP);
+		}
+		stats.cacheMisses++;
+	}
+
+	clock = clock.charge(stats, SETUP);
+
+	string endState;
+	switch (algorithm) {
+	case BFS:
+		endState = bfs(startState);
+		break;
+	case DFS:
+		endState = dfs(startState);
+		break;
+	case OOPL:
+		endState = aStar(startState, MisplacedPolicy<P>());
+		break;
+	case MHTTN:
+		endState = aStar(startState, ManhattanPolicy<P>());
+		break;
+	case DB:
+		endState = dbSolve(startState, *options.database);
+		break;
+	case IDA:
+		endState = ida(startState, ManhattanPolicy<P>());
+		break;
+	case LC:
+		endState = aStar(startState, LinearConflictPolicy<P>());
+		break;
+	case WD:
+		endState = aStar(startState, WalkingDistancePolicy<P>());
+		break;
+	case IDA_LC:
+		endState = ida(startState, LinearConflictPolicy<P>());
+		break;
+	case IDA_WD:
+		endState = ida(startState, WalkingDistancePolicy<P>());
+		break;
+	case PDB:
+		endState = aStar(startState, PatternPolicy<P>{ options.patterns });
+		break;
+	case IDA_PDB:
+		endState = ida(startState, PatternPolicy<P>{ options.patterns });
+		break;
+	case BIBFS:
+		endState = biBfs(startState);
+		break;
+	case HDA:
+		endState = hda(startState, options.threads);
+		break;
+	case PIDA:
+		endState = parallelIda(startState, ManhattanPolicy<P>(), options.threads);
+		break;
+	case PIDA_LC:
+		endState = parallelIda(startState, LinearConflictPolicy<P>(), options.threads);
+		break;
+	case PIDA_WD:
+		endState = parallelIda(startState, WalkingDistancePolicy<P>(), options.threads);
+		break;
+	case PIDA_PDB:
+		endState = parallelIda(startState, PatternPolicy<P>{ options.patterns }, options.threads);
+		break;
+	}
+
+	clock = clock.charge(stats, SEARCH);
+
+	// anything but the GOALSTATE results in an unsuccessful search
+	result.status = endState == P::goalString() ? SOLVED : NOT_FOUND;
+	result.finalState = P::unpackState(curr.state);
+	result.depth = curr.depth;
+	result.count = curr.count;
+	result.nodes = counter;
+	result.moves = pathMoves();
+
+	// only solutions are cached, the other outcomes are quick to find again
+	if (options.cache != NULL && result.status == SOLVED) {
+		bool mirrored;
+		CacheKey key = { (unsigned __int128)P::canonicalState(startState, mirrored).tiles, P::CELLS, algorithm };
+		string path = result.compactPath();
+		for (unsigned int m = 0; mirrored && m < path.size(); m++) {
+			path[m] = "RDLU"[mirrorMove((int)string("RDLU").find(path[m]))];
+		}
+		options.cache->insert(key, result.depth, path);
+	}
+	return withStats(result, clock, PATH);
+}
+
+// reset the counter, visited bitset, node pool and open lists
+template <class P>
+void Solver<P>::reset() {
+	// initialize counter to 1
+	counter = 1;
+	stats = SearchStats();
+
+	// no search has chosen its data structure yet
+	dataStructure = 0;
+
+	// clear the visited states
+	visited.clear();
+
+	// drop the stored nodes, the arenas rewind and the open lists keep their capacity
+	nodePool.rewind();
+	bfsFront = 0;
+	dfsStack.rewind();
+	biFrontier[FORWARD].clear();
+	biFrontier[BACKWARD].clear();
+	biNext.clear();
+	aStarOpen.clear();
+}
+
+// test-and-set the visited bit of a state, return true if it was not visited before
+template <class P>
+bool Solver<P>::visitState(const Board& state) {
+	return visited.visit(state);
+}
+
+// record the depth of a state, return true if it is new or was only reached by a longer path
+template <class P>
+bool Solver<P>::improveState(const Board& state, int depth) {
+	return visited.improve(state, depth);
+}
+
+// build a temp node with current state data
+template <class P>
+void Solver<P>::buildNode(const Board& tempState, int move) {
+
+	neighbor.state = tempState;  // assign tempState
+	neighbor.parent = currIndex; // working node is the parent
+	neighbor.move = move; // move that produced tempState
+	neighbor.depth = curr.depth + 1; // working node depth + 1
+	neighbor.count = counter; // assign counter
+
+};
+
+// insert node into the data structure that the search is using
+template <class P>
+void Solver<P>::insertDataStructure() {
+
+	// int dataStructure is initialized in each search function
+	switch (dataStructure) {
+	case 1: // 1 equals BFS
+
+		nodePool.push_back(neighbor); // store neighbor node, this also enqueues it
+		break;
+
+	case 2: // 2 equals DFS
+
+		nodePool.push_back(neighbor); // store neighbor node
+		dfsStack.push_back(nodePool.size() - 1); // push neighbor node index onto stack
+		break;
+	}
+
+}
+
+// generate the children of a state through the neighbor table, keep the unvisited ones
+template <class P>
+int Solver<P>::generateChildren(const Board& workingState, Board children[], int moves[]) {
+	stats.expanded++;
+
+	int count = 0;
+	for (int move = RIGHT; move <= UP; move++) {
+		int to = P::NEIGHBORS[workingState.blank][move];
+
+		// the blank cannot leave the board in this direction
+		if (to < 0) {
+			continue;
+		}
+
+		// build the child state with a shift/mask swap
+		Board tempState = P::slideBlank(workingState, to);
+		stats.generated++;
+
+		// mark state as visited, skip it if it was already seen
+		if (visitState(tempState)) {
+			children[count] = tempState;
+			moves[count] = move;
+			count++;
+		}
+		else {
+			stats.duplicates++;
+		}
+	}
+	return count;
+}
+
+// store and queue the kept children
+template <class P>
+void Solver<P>::storeChildren(const Board children[], const int moves[], int count) {
+	for (int c = 0; c < count; c++) {
+
+		counter++; // increment counter
+
+		buildNode(children[c], moves[c]); // build a temporary node with updated data
+		insertDataStructure(); // insert node into the data structure that the search is using
+	}
+}
+
+template <class P>
+void Solver<P>::addRoot(const Board& start, int heuristic) {
+
+	Node e;  // create entrance node;
+
+	e.state = start; // starting state, packed w/ its empty point
+	improveState(e.state, 0); // mark startState as visited at depth 0
+	e.depth = 0; // depth of root
+	e.count = counter; // start count
+	e.parent = -1; // the root has no parent
+	e.move = -1; // and no move
+	e.heuristic = heuristic; // full h(n) once, per move after
+	e.cheapest = e.heuristic; // f(n) = 0 + h(n)
+
+	nodePool.push_back(e); // store entrance node
+	currIndex = 0;
+	curr = e;
+}
+
+template <class P>
+string Solver<P>::bfs(const Board& startState) {
+
+	dataStructure = 1; // initialize data structure (1 = queue)
+
+	addRoot(startState, 0); // enqueue entrance node
+
+	Board workingState;  // declare workingState Board
+	PROFILE_SEARCH(profile);
+
+	// while queue is not empty
+	while (bfsFront < nodePool.size()) {
+		PROFILE_NEXT(profile);
+		{
+			PROFILE_SCOPE(profile, PROFILE_POP);
+			currIndex = bfsFront;  // current node equals front of queue
+			curr = nodePool[currIndex];
+		}
+		workingState = curr.state; // assign workingState to current node value
+
+		// check for goal state, if it matches, return working state and exit the search
+		if (P::checkGoal(workingState)) {
+			return P::unpackState(workingState);
+		}
+
+		bfsFront++;  // Else, dequeue the the front node and start the search
+
+		// generate children through the move table, then store and queue the unvisited ones
+		Board children[4];
+		int moves[4];
+		int count;
+		{
+			PROFILE_SCOPE(profile, PROFILE_GENERATE);
+			count = generateChildren(workingState, children, moves);
+		}
+		{
+			PROFILE_SCOPE(profile, PROFILE_PUSH);
+			storeChildren(children, moves, count);
+		}
+		SearchStats::raise(stats.peakOpen, nodePool.size() - bfsFront);
+	}
+
+	// every reachable state was searched without finding the goal
+	return "not found";
+}
+
+template <class P>
+string Solver<P>::dfs(const Board& startState) {
+
+	dataStructure = 2; // initialize data structure (2 = stack)
+
+	addRoot(startState, 0);
+	dfsStack.push_back(0); // push entrance node index
+
+	Board workingState; // declare workingState Board
+	PROFILE_SEARCH(profile);
+
+	// while stack is not empty
+	while (!dfsStack.empty()) {
+		PROFILE_NEXT(profile);
+
+		{
+			PROFILE_SCOPE(profile, PROFILE_POP);
+			currIndex = dfsStack.back();  // current node equals top of stack
+			curr = nodePool[currIndex];
+		}
+		workingState = curr.state; // assign workingState to current node value
+
+		// check for goal state, if it matches, return working state and exit the search
+		if (P::checkGoal(workingState)) {
+			return P::unpackState(workingState);
+		}
+
+		dfsStack.pop_back();  // Else, pop the the top node and start the search
+
+		// generate children through the move table, then store and queue the unvisited ones
+		Board children[4];
+		int moves[4];
+		int count;
+		{
+			PROFILE_SCOPE(profile, PROFILE_GENERATE);
+			count = generateChildren(workingState, children, moves);
+		}
+		{
+			PROFILE_SCOPE(profile, PROFILE_PUSH);
+			storeChildren(children, moves, count);
+		}
+		SearchStats::raise(stats.peakOpen, dfsStack.size());
+	}
+
+	// every reachable state was searched without finding the goal
+	return "not found";
+}
+
+template <class P>
+string Solver<P>::biBfs(const Board& startState) {
+
+	dataStructure = 6; // initialize data structure (6 = a BFS level list per side)
+
+	addRoot(startState, 0); // start side root, recorded at depth 0, which is also the FORWARD side
+	biFrontier[FORWARD].push_back(0);
+
+	// goal side root
+	counter++; // increment counter
+	Node g = curr;
+	g.state = P::GOALSTATE;
+	g.count = counter;
+	visited.reach(g.state, BACKWARD);
+	nodePool.push_back(g);
+	biFrontier[BACKWARD].push_back(1);
+
+	// while both sides have a frontier
+	while (!biFrontier[FORWARD].empty() && !biFrontier[BACKWARD].empty()) {
+
+		// grow the smaller frontier by one whole level
+		int side = biFrontier[FORWARD].size() <= biFrontier[BACKWARD].size() ? FORWARD : BACKWARD;
+
+		biNext.clear();
+		for (unsigned int i = 0; i < biFrontier[side].size(); i++) {
+			currIndex = biFrontier[side][i];
+			curr = nodePool[currIndex];
+			stats.expanded++;
+
+			// generate children through the move table
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[curr.state.blank][move];
+
+				// the blank cannot leave the board in this direction
+				if (to < 0) {
+					continue;
+				}
+
+				// build the child state with a shift/mask swap
+				Board tempState = P::slideBlank(curr.state, to);
+				stats.generated++;
+
+				// skip the child if this side already reached it
+				int owner = visited.reach(tempState, side);
+				if (owner == side) {
+					stats.duplicates++;
+					continue;
+				}
+
+				counter++; // increment counter
+
+				buildNode(tempState, move); // build a temporary node with updated data
+				nodePool.push_back(neighbor); // store neighbor node
+				int child = nodePool.size() - 1;
+
+				// the other side reached this state or its mirror, and only from its last level:
+				// nothing closer was missed, so the two halves add up to an optimal path
+				if (owner >= 0) {
+					int other = side ^ 1;
+					bool mirrored;
+					Board canonical = P::canonicalState(tempState, mirrored);
+					for (unsigned int j = 0; j < biFrontier[other].size(); j++) {
+						if (P::canonicalState(nodePool[biFrontier[other][j]].state, mirrored) == canonical) {
+							int meeting = biFrontier[other][j];
+							return side == FORWARD ? spliceMeeting(child, meeting) : spliceMeeting(meeting, child);
+						}
+					}
+				}
+
+				biNext.push_back(child);
+			}
+		}
+		SearchStats::raise(stats.peakOpen, biFrontier[FORWARD].size() + biFrontier[BACKWARD].size() + biNext.size());
+		biFrontier[side].swap(biNext);
+	}
+
+	// every reachable state was searched without finding the goal
+	return "not found";
+}
+
+template <class P>
+string Solver<P>::spliceMeeting(int forward, int backward) {
+
+	currIndex = forward;
+	curr = nodePool[forward];
+
+	// the two sides may have met on a state and its mirror, then the goal side moves are mirrored
+	bool mirrored = nodePool[forward].state != nodePool[backward].state;
+
+	// the goal side nodes were generated from the goal, so undo each of their moves in turn
+	// The path is stored in the node pool, so the result is built as for the other searches.
+	for (int node = backward; nodePool[node].parent >= 0; node = nodePool[node].parent) {
+		int move = mirrored ? mirrorMove(nodePool[node].move ^ 2) : nodePool[node].move ^ 2;
+		buildNode(P::slideBlank(curr.state, P::NEIGHBORS[curr.state.blank][move]), move);
+		nodePool.push_back(neighbor);
+		currIndex = nodePool.size() - 1;
+		curr = neighbor;
+	}
+	return P::unpackState(curr.state);
+}
+
+template <class P>
+template <class Heuristic>
+string Solver<P>::aStar(const Board& startState, const Heuristic& heuristic){
+
+	dataStructure = 3; // initialize data structure (3 = A* search, bucketed open list)
+
+	addRoot(startState, heuristic.evaluate(startState));
+	aStarOpen.push(0, curr.heuristic, 0); // push entrance node index
+
+	Board workingState; // declare workingState Board
+	PROFILE_SEARCH(profile);
+
+	// while open list is not empty
+	while (!aStarOpen.empty()) {
+		PROFILE_NEXT(profile);
+
+		{
+			PROFILE_SCOPE(profile, PROFILE_POP);
+			currIndex = aStarOpen.pop();  // current node equals the cheapest queued node, popped off
+			curr = nodePool[currIndex];
+		}
+		workingState = curr.state; // assign workingState to current node value
+
+		// check for goal state, if it matches, return working state and exit the search
+		if (P::checkGoal(workingState)) {
+			return P::unpackState(workingState);
+		}
+
+		// a shorter path to this state was queued after this node, the node is stale
+		if (curr.depth > visited.depth(workingState)) {
+			continue;
+		}
+		stats.expanded++;
+
+		// children of this node, collected so the policy evaluates them as one batch
+		ChildBatch<P> batch;
+
+		// generate children through the move table
+		{
+			PROFILE_SCOPE(profile, PROFILE_GENERATE);
+			for (int move = RIGHT; move <= UP; move++) {
+				int to = P::NEIGHBORS[workingState.blank][move];
+
+				// the blank cannot leave the board in this direction
+				if (to < 0) {
+					continue;
+				}
+
+				// build the child state with a shift/mask swap
+				Board tempState = P::slideBlank(workingState, to);
+				stats.generated++;
+
+				// skip the child if it was already reached in as few moves, states close on expansion
+				if (improveState(tempState, curr.depth + 1)) {
+
+					// the tile on "to" slid into the parent's blank cell
+					batch.add(tempState, P::tileAt(tempState, workingState.blank), to, workingState.blank, move);
+				}
+				else {
+					stats.duplicates++;
+				}
+			}
+		}
+
+		// h(n) of every child
+		int childH[ChildBatch<P>::CAPACITY];
+		{
+			PROFILE_SCOPE(profile, PROFILE_HEURISTIC);
+			heuristic.updateBatch(curr.heuristic, batch, childH);
+		}
+
+		{
+			PROFILE_SCOPE(profile, PROFILE_PUSH);
+			for (int c = 0; c < batch.count; c++) {
+
+				counter++; // increment counter
+
+				buildNode(batch.child(c), batch.move[c]); // build a temporary node with updated data
+				neighbor.heuristic = childH[c];
+
+				// f(n) = g(n) + h(n)
+				neighbor.cheapest = neighbor.depth + neighbor.heuristic;
+
+				nodePool.push_back(neighbor); // store neighbor node
+				aStarOpen.push(nodePool.size() - 1, neighbor.cheapest, neighbor.depth); // push neighbor node index
+			}
+		}
+		SearchStats::raise(stats.peakOpen, aStarOpen.size());
+	}
+
+	// every reachable state was searched without finding the goal
+	return "not found";
+}
+
+template <class P>
+string Solver<P>::hda(const Board& startState, int threads) {
+
+	dataStructure = 7; // initialize data structure (7 = HDA*, an open list per worker)
+
+	addRoot(startState, ManhattanPolicy<P>().evaluate(startState));
+
+	vector<int> moves;
+	bool found = hdaSearch.run(startState, threads, moves);
+	counter += hdaSearch.nodes(); // the root was counted by reset()
+	stats.merge(hdaSearch.stats());
+
+	if (!found) {
+		return "not found";
+	}
+
+	// store the solution path in the node pool, so the result is built as for the other searches
+	for (unsigned int m = 0; m < moves.size(); m++) {
+		buildNode(P::slideBlank(curr.state, P::NEIGHBORS[curr.state.blank][moves[m]]), moves[m]);
+		nodePool.push_back(neighbor);
+		currIndex = nodePool.size() - 1;
+		curr = neighbor;
+	}
+	return P::unpackState(curr.state);
+}
+
+// only the 3x3 board has a distance database, solve() rejects DB on the others
+template <class P>
+string Solver<P>::dbSolve(const Board&, const DistanceDatabase&) {
+	return "not found";
+}
+
+template <>
+string Solver<Puzzle8>::dbSolve(const Board& startState, const DistanceDatabase& database) {
+
+	addRoot(startState, 0);
+
+	// follow the stored best move until the goal, one step per level of distance
+	while (!Puzzle8::checkGoal(curr.state)) {
+		int move = database.bestMove(curr.state);
+		stats.expanded++;
+		stats.generated++;
+
+		counter++; // increment counter
+		buildNode(Puzzle8::slideBlank(curr.state, Puzzle8::NEIGHBORS[curr.state.blank][move]), move);
+
+		nodePool.push_back(neighbor);
+		currIndex = nodePool.size() - 1;
+		curr = neighbor;
+	}
+	return Puzzle8::unpackState(curr.state);
+}
+
+template <class P>
+vector<int> Solver<P>::pathMoves() const {
+	// one move per level, filled from the last
+	vector<int> moves(curr.depth);
+	for (int node = currIndex; nodePool[node].parent >= 0; node = nodePool[node].parent) {
+		moves[nodePool[node].depth - 1] = nodePool[node].move;
+	}
+	return moves;
+}
+
+template <class P>
+template <class Heuristic>
+string Solver<P>::ida(const Board& startState, const Heuristic& heuristic) {
+
+	dataStructure = 5; // initialize data structure (5 = IDA*, no open list)
+
+	addRoot(startState, heuristic.evaluate(startState));
+
+	idaBoard = startState; // the board every probe moves on
+
+	// the first bound is the heuristic of the start state, each iteration raises it
+	// to the smallest f that went over the previous bound
+	int bound = curr.heuristic;
+	while (bound < IDA_MAX_DEPTH) {
+		int next = idaProbe(heuristic, 0, bound, -1, curr.heuristic);
+
+		if (next < 0) {
+			// store the solution path in the node pool, so the result is built as for the other searches
+			for (int d = 0; d < idaDepth; d++) {
+				buildNode(P::slideBlank(curr.state, P::NEIGHBORS[curr.state.blank][idaMoves[d]]), idaMoves[d]);
+				nodePool.push_back(neighbor);
+				currIndex = nodePool.size() - 1;
+				curr = neighbor;
+			}
+			return P::unpackState(curr.state);
+		}
+		bound = next;
+	}
+
+	// no solution within the path buffer
+	return "not found";
+}
+
+template <class P>
+template <class Heuristic>
+string Solver<P>::parallelIda(const Board& startState, const Heuristic& heuristic, int threads) {
+
+	dataStructure = 8; // initialize data structure (8 = parallel IDA*, work-stealing queues of subtrees)
+
+	addRoot(startState, heuristic.evaluate(startState));
+
+	vector<int> moves;
+	bool found = pida.run(startState, heuristic, threads, moves);
+	counter += pida.nodes(); // the root was counted by reset()
+	stats.merge(pida.stats());
+
+	// no solution within the path buffer
+	if (!found) {
+		return "not found";
+	}
+
+	// store the solution path in the node pool, so the result is built as for the other searches
+	for (unsigned int m = 0; m < moves.size(); m++) {
+		buildNode(P::slideBlank(curr.state, P::NEIGHBORS[curr.state.blank][moves[m]]), moves[m]);
+		nodePool.push_back(neighbor);
+		currIndex = nodePool.size() - 1;
+		curr = neighbor;
+	}
+	return P::unpackState(curr.state);
+}
+
+template <class P>
+template <class Heuristic>
+int Solver<P>::idaProbe(const Heuristic& heuristic, int depth, int bound, int lastMove, int h) {
+
+	// f(n) = g(n) + h(n)
+	int f = depth + h;
+	if (f > bound) {
+		return f;
+	}
+
+	// the first goal reached is an optimal one, every shallower bound failed
+	if (P::checkGoal(idaBoard)) {
+		idaDepth = depth;
+		return -1;
+	}
+
+	int blank = idaBoard.blank; // blank cell to undo each move to
+	int next = INT_MAX; // smallest f over the bound below this node
+	stats.expanded++;
+	SearchStats::raise(stats.peakOpen, depth + 1); // IDA* only holds the current path
+	for (int move = RIGHT; move <= UP; move++) {
+		int to = P::NEIGHBORS[blank][move];
+
+		// the blank cannot leave the board, and undoing the parent move only wastes a probe
+		if (to < 0 || move == (lastMove ^ 2)) {
+			continue;
+		}
+
+		counter++; // increment counter
+		stats.generated++;
+
+		// make the move, probe below it, then unmake it
+		int tile = P::tileAt(idaBoard, to);
+		idaBoard = P::slideBlank(idaBoard, to);
+		idaMoves[depth] = move;
+
+		// h(n) of the child, the tile on "to" slid into the blank cell
+		int childH = heuristic.update(h, idaBoard, tile, to, blank);
+
+		int t = idaProbe(heuristic, depth + 1, bound, move, childH);
+		if (t < 0) {
+			return t;
+		}
+		idaBoard = P::slideBlank(idaBoard, blank);
+
+		if (t < next) {
+			next = t;
+		}
+	}
+	return next;
+}
+
+template <class P>
+SolveResult Solver<P>::withStats(SolveResult& result, const PhaseClock& since, SearchPhase phase) {
+	since.charge(stats, phase);
+
+	// the visited set only grows during a search, so its final size is its peak
+	SearchStats::raise(stats.peakVisited, visited.size());
+
+	// storage the Solver holds, the engines of the parallel searches merged theirs in already
+	stats.bytes += nodePool.bytes() + dfsStack.bytes()
+		+ (biFrontier[FORWARD].capacity() + biFrontier[BACKWARD].capacity() + biNext.capacity()) * sizeof(int)
+		+ aStarOpen.bytes() + visited.bytes();
+
+	result.stats = stats;
+	return result;
+}
+
+// the board sizes the program is built for
+template class Solver<Puzzle8>;
+template class Solver<Puzzle15>;
+template class Solver<Puzzle24>;
@@ -0,0 +1,256 @@
+/* Slider Puzzle Solver
+*
+* Reentrant solver API. A Solver owns every piece of mutable search state (the
+* node pool, open lists and visited bitset), so independent Solvers can run at
+* the same time on different threads. One Solver is meant to be reused: each
+* solve() resets the previous search in place and keeps the allocated storage.
+* Nodes and index stacks live in arenas (arena.h) and the visited set is
+* cleared by a generation bump, so the reset costs the same for any search.
+* The Solver is a template on the Puzzle (board size, board.h) it searches.
+*
+*     Solver<Puzzle8> solver;
+*     SolveResult result = solver.solve("1234E5678", MHTTN, SolveOptions());
+*
+* Every SolveResult carries the counters and phase timings of its search
+* (search_stats.h). With a solution cache in the options, a start state solved
+* before by the same algorithm, or its mirror (board.h), returns its stored
+* depth and path at once (solution_cache.h).
+*
+* File:   solver.h
+*/
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <string>
+#include <vector>
+
+#include "algorithm.h"
+#include "arena.h"
+#include "board.h"
+#include "bucket_queue.h"
+#include "distance_db.h"
+#include "hda.h"
+#include "parallel_ida.h"
+#include "pattern_db.h"
+#include "profiler.h"
+#include "search_stats.h"
+#include "solution_cache.h"
+#include "state_set.h"
+
+// longest path an IDA* search can hold in its path buffer
+#define IDA_MAX_DEPTH 256
+
+// outcome of one solve
+enum SolveStatus {
+	SOLVED, // the goal state was reached
+	NOT_FOUND, // the search ended without reaching the goal
+	UNSOLVABLE, // the start state cannot reach the goal state
+	INVALID // the start state is malformed, a database the algorithm needs is not open, or the algorithm does not cover the board size
+};
+
+// settings for one solve
+struct SolveOptions {
+
+	// open distance database for the DB algorithm (3x3 only), shared read-only between Solvers
+	const DistanceDatabase* database = NULL;
+
+	// open pattern databases for the PDB algorithms, shared read-only between Solvers
+	const PatternDatabaseSet* patterns = NULL;
+
+	// worker threads of the HDA and PIDA algorithms, 0 for one per core
+	int threads = 0;
+
+	// solutions of earlier solves, looked up before and filled in after every search, shared between Solvers
+	SolutionCache* cache = NULL;
+};
+
+// everything a caller needs from one solve
+struct SolveResult {
+
+	SolveStatus status = INVALID; // outcome of the solve
+
+	std::string startState; // start state as given ("12345678E" form on 3x3, comma-separated above)
+
+	std::string finalState; // state the search stopped on
+
+	int depth = -1; // depth of the final node, the number of moves when solved
+
+	int count = 0; // generation count of the final node
+
+	int nodes = 0; // number of nodes generated by the search
+
+	SearchStats stats; // counters and phase timings of the search
+
+	std::vector<int> moves; // blank Moves from the start state to the final state
+
+	// return the path as one blank direction letter (R, D, L, U) per move
+	std::string compactPath() const;
+};
+
+// return the name of a solve status ("solved", "not found", "unsolvable", "invalid")
+std::string statusName(SolveStatus status);
+
+// search node, each Solver declares "curr" and "neighbor" nodes
+// Nodes are stored once in the node pool and the path is rebuilt from the
+// parent indices when a goal is found.
+template <class P>
+struct Node {
+
+	typename P::Board state; // current state of the puzzle
+
+	int parent; // node pool index of the parent node, -1 for the root
+
+	int move; // Move code that produced this node from its parent
+
+	int depth; // current depth of the search
+
+	int count; // counter for generated nodes
+
+	int cheapest;  // the A* f(n) value
+
+	int heuristic; // the A* h(n) value, updated from the parent's per move
+
+};
+
+// the two searches of a bidirectional BFS, also the side recorded for each state it reaches
+enum Side { FORWARD = 0, BACKWARD = 1 };
+
+// reusable search state and the search methods that run on it, for one board size
+template <class P>
+class Solver {
+public:
+
+	// packed state of the board size
+	typedef typename P::Board Board;
+
+	// search node of the board size
+	typedef ::Node<P> Node;
+
+	Solver() = default;
+
+	// a Solver holds a few MB of search storage, reuse it rather than copy it
+	Solver(const Solver&) = delete;
+	Solver& operator=(const Solver&) = delete;
+
+	// solve a start state ("12345678E" form on 3x3, comma-separated tiles above) with the chosen algorithm
+	SolveResult solve(const std::string& start, Algorithm algorithm, const SolveOptions& options);
+
+	// forget the last search, the node pool and open lists keep their storage
+	void reset();
+
+private:
+
+	// mark a state as visited, return true if it was not visited before
+	bool visitState(const Board& state);
+
+	// record a path of "depth" moves to a state, return true if no shorter or equal path was recorded
+	bool improveState(const Board& state, int depth);
+
+	// build a temporary node
+	void buildNode(const Board& tempState, int move);
+
+	// insert node into a data structure
+	void insertDataStructure();
+
+	// generate the children of a state through the neighbor table, write the unvisited ones and their moves, return their number
+	int generateChildren(const Board& workingState, Board children[], int moves[]);
+
+	// store and queue the children generateChildren() kept
+	void storeChildren(const Board children[], const int moves[], int count);
+
+	// store the entrance node of a search w/ its h(n) and mark it visited
+	void addRoot(const Board& start, int heuristic);
+
+	// Breadth-first search function to find possible solution to puzzle
+	std::string bfs(const Board& startState);
+
+	// Depth-first search function to find possible solution to puzzle
+	std::string dfs(const Board& startState);
+
+	// Bidirectional breadth-first search function, grows the smaller of the start and goal frontiers
+	std::string biBfs(const Board& startState);
+
+	// join the start side path to "forward" and the goal side path from "backward" (the same state or its mirror) into one path
+	std::string spliceMeeting(int forward, int backward);
+
+	// A* search function to find possible solution to puzzle w/ a heuristic policy (heuristics.h)
+	template <class Heuristic>
+	std::string aStar(const Board& startState, const Heuristic& heuristic);
+
+	// A* search w/ the Manhattan distance spread over "threads" workers by state hash (hda.h)
+	std::string hda(const Board& startState, int threads);
+
+	// solve the start state by greedy descent through the distance database
+	std::string dbSolve(const Board& startState, const DistanceDatabase& database);
+
+	// Iterative-deepening A* search function w/ a heuristic policy, O(depth) memory
+	template <class Heuristic>
+	std::string ida(const Board& startState, const Heuristic& heuristic);
+
+	// Iterative-deepening A* search w/ a heuristic policy, subtrees spread over "threads" workers (parallel_ida.h)
+	template <class Heuristic>
+	std::string parallelIda(const Board& startState, const Heuristic& heuristic, int threads);
+
+	// search below one f bound from idaBoard (h = its heuristic), return the smallest f over the bound or -1 at the goal
+	template <class Heuristic>
+	int idaProbe(const Heuristic& heuristic, int depth, int bound, int lastMove, int h);
+
+	// return the moves from the root to the "curr" node by walking the parent indices
+	std::vector<int> pathMoves() const;
+
+	// charge the time since "since" to a phase, then copy the stats, visited set size and storage bytes into a result
+	SolveResult withStats(SolveResult& result, const PhaseClock& since, SearchPhase phase);
+
+	Node curr; // working node
+
+	Node neighbor; // temporary child node
+
+	// node pool index of the "curr" node
+	int currIndex = 0;
+
+	// declare and initialize counter
+	int counter = 1;
+
+	// counters and phase timings of the current search
+	SearchStats stats;
+
+	// marks the data structure to use
+	int dataStructure = 0;
+
+	// visited states and the shortest depth found to each, ranked on 3x3 and hashed above
+	StateSet<P> visited;
+
+	// every node generated by the current search, open lists hold indices into it
+	Arena<Node> nodePool;
+
+	// BFS queue: nodes enter the pool in queue order, so the queue is the pool from this index on
+	size_t bfsFront = 0;
+
+	// stack of Node indices for the DFS search
+	Arena<int> dfsStack;
+
+	// current level of Node indices on each Side of the bidirectional BFS, and the level being built
+	std::vector<int> biFrontier[2];
+	std::vector<int> biNext;
+
+	// open list of Node indices for the A* searches, bucketed by f(n) and g(n)
+	BucketQueue aStarOpen;
+
+	// per worker open lists and closed sets of the HDA* search
+	HdaSearch<P> hdaSearch;
+
+	// work units of the parallel IDA* search
+	ParallelIda<P> pida;
+
+	// the one board IDA* moves the blank around on, each move is undone on the way back
+	Board idaBoard;
+
+	// moves from the start state to idaBoard
+	int idaMoves[IDA_MAX_DEPTH];
+
+	// number of moves to the goal once a probe reaches it
+	int idaDepth = 0;
+};
+
+#endif
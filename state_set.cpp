@@ -0,0 +1,214 @@
+/* Slider Puzzle State Set
+*
+* See state_set.h.
+*
+* File:   state_set.cpp
+*/
+
+#include "state_set.h"
+
+#include <algorithm>
+
+using namespace std;
+
+size_t TilesHash::operator()(uint64_t tiles) const {
+	tiles ^= tiles >> 33;
+	tiles *= 0xFF51AFD7ED558CCDULL;
+	tiles ^= tiles >> 33;
+	tiles *= 0xC4CEB9FE1A85EC53ULL;
+	tiles ^= tiles >> 33;
+	return (size_t)tiles;
+}
+
+size_t TilesHash::operator()(unsigned __int128 tiles) const {
+	return (*this)((uint64_t)tiles ^ (*this)((uint64_t)(tiles >> 64)));
+}
+
+// test-and-set the visited bit of a state, return true if it was not visited before
+template <class P>
+bool StateSet<P, true>::visit(const typename P::Board& state) {
+	bool mirrored;
+	int rank = P::rankCanonical(state, mirrored);
+	if (visited.test(rank)) {
+		return false;
+	}
+	visited.set(rank);
+	count++;
+	return true;
+}
+
+// record the depth of a state, return true if it is new or was only reached by a longer path
+// The A* searches close states on expansion, not generation, so a shorter path
+// found later still gets queued and the first goal popped is an optimal one.
+template <class P>
+bool StateSet<P, true>::improve(const typename P::Board& state, int depth) {
+	bool mirrored;
+	int rank = P::rankCanonical(state, mirrored);
+	if (visited.test(rank)) {
+		if (bestDepth[rank] <= depth) {
+			return false;
+		}
+	}
+	else {
+		visited.set(rank);
+		count++;
+	}
+	bestDepth[rank] = (uint8_t)depth;
+	return true;
+}
+
+template <class P>
+int StateSet<P, true>::depth(const typename P::Board& state) const {
+	bool mirrored;
+	return bestDepth[P::rankCanonical(state, mirrored)];
+}
+
+template <class P>
+int StateSet<P, true>::reach(const typename P::Board& state, int side) {
+	bool mirrored;
+	int rank = P::rankCanonical(state, mirrored);
+	if (visited.test(rank)) {
+		return bestDepth[rank];
+	}
+	visited.set(rank);
+	count++;
+	bestDepth[rank] = (uint8_t)side;
+	return -1;
+}
+
+// the depth table is only read where the visited bit is set, so it needs no clearing
+template <class P>
+void StateSet<P, true>::clear() {
+	visited.reset();
+	count = 0;
+}
+
+template <class P>
+size_t StateSet<P, true>::size() const {
+	return count;
+}
+
+template <class P>
+size_t StateSet<P, true>::bytes() const {
+	return sizeof(visited) + bestDepth.capacity();
+}
+
+template <class P>
+typename StateSet<P, false>::Slot& StateSet<P, false>::find(const typename P::Tiles& tiles) {
+	if ((count + 1) * 2 > slots.size()) {
+		grow();
+	}
+	size_t mask = slots.size() - 1;
+	for (size_t i = TilesHash()(tiles) & mask; ; i = (i + 1) & mask) {
+		Slot& slot = slots[i];
+		if (slot.generation != generation || slot.tiles == tiles) {
+			return slot;
+		}
+	}
+}
+
+template <class P>
+void StateSet<P, false>::grow() {
+	vector<Slot> old(max((size_t)1024, slots.size() * 2), Slot());
+	old.swap(slots);
+	size_t mask = slots.size() - 1;
+	for (unsigned int s = 0; s < old.size(); s++) {
+		if (old[s].generation != generation) {
+			continue;
+		}
+		size_t i = TilesHash()(old[s].tiles) & mask;
+		while (slots[i].generation == generation) {
+			i = (i + 1) & mask;
+		}
+		slots[i] = old[s];
+	}
+}
+
+// insert a state, return true if it was not in the table before
+template <class P>
+bool StateSet<P, false>::visit(const typename P::Board& state) {
+	bool mirrored;
+	typename P::Tiles tiles = P::canonicalState(state, mirrored).tiles;
+	Slot& slot = find(tiles);
+	if (slot.generation == generation) {
+		return false;
+	}
+	slot.tiles = tiles;
+	slot.generation = generation;
+	slot.depth = 0xFF;
+	count++;
+	return true;
+}
+
+// record the depth of a state, return true if it is new or was only reached by a longer path
+template <class P>
+bool StateSet<P, false>::improve(const typename P::Board& state, int depth) {
+	bool mirrored;
+	typename P::Tiles tiles = P::canonicalState(state, mirrored).tiles;
+	Slot& slot = find(tiles);
+	if (slot.generation == generation) {
+		if (slot.depth <= depth) {
+			return false;
+		}
+	}
+	else {
+		slot.tiles = tiles;
+		slot.generation = generation;
+		count++;
+	}
+	slot.depth = (uint8_t)depth;
+	return true;
+}
+
+// the state must be in the table, so the probe ends on it
+template <class P>
+int StateSet<P, false>::depth(const typename P::Board& state) const {
+	bool mirrored;
+	typename P::Tiles tiles = P::canonicalState(state, mirrored).tiles;
+	size_t mask = slots.size() - 1;
+	size_t i = TilesHash()(tiles) & mask;
+	while (slots[i].tiles != tiles || slots[i].generation != generation) {
+		i = (i + 1) & mask;
+	}
+	return slots[i].depth;
+}
+
+template <class P>
+int StateSet<P, false>::reach(const typename P::Board& state, int side) {
+	bool mirrored;
+	typename P::Tiles tiles = P::canonicalState(state, mirrored).tiles;
+	Slot& slot = find(tiles);
+	if (slot.generation == generation) {
+		return slot.depth;
+	}
+	slot.tiles = tiles;
+	slot.generation = generation;
+	slot.depth = (uint8_t)side;
+	count++;
+	return -1;
+}
+
+// slots of older generations read as empty, the table is only wiped when the generation wraps
+template <class P>
+void StateSet<P, false>::clear() {
+	if (++generation == 0) {
+		fill(slots.begin(), slots.end(), Slot());
+		generation = 1;
+	}
+	count = 0;
+}
+
+template <class P>
+size_t StateSet<P, false>::size() const {
+	return count;
+}
+
+template <class P>
+size_t StateSet<P, false>::bytes() const {
+	return slots.capacity() * sizeof(Slot);
+}
+
+// the board sizes the program is built for
+template class StateSet<Puzzle8>;
+template class StateSet<Puzzle15>;
+template class StateSet<Puzzle24>;
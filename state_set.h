@@ -0,0 +1,133 @@
+/* Slider Puzzle State Set
+*
+* The visited states of a search and the shortest depth each was reached at,
+* or for a bidirectional search the side (start or goal) that reached it first.
+* Only canonical states are stored (board.h): a search that reached a state's
+* mirror at a depth has a path to the goal of the same length from there, so
+* reaching the state itself as deep or deeper gains nothing. A RANKED board
+* (3x3) indexes a bitset and a depth table by rankCanonical(), which covers its
+* whole state space in about 130 KB. Larger boards have far too many states
+* for that, so they keep the states they reach in an open-addressed hash table
+* keyed by the packed canonical tiles.
+*
+* Every hash table slot carries the generation of the search that wrote it,
+* and a slot of an older generation reads as empty. clear() only bumps the
+* generation, so a Solver running millions of small searches never walks or
+* frees its table between them; the table is wiped once when the generation
+* wraps around. The bitset is small enough to reset outright.
+*
+* File:   state_set.h
+*/
+
+#ifndef STATE_SET_H
+#define STATE_SET_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+
+// hash of a packed tiles word (a 64-bit finalizer mix, applied to each half of a 128-bit word)
+struct TilesHash {
+	size_t operator()(uint64_t tiles) const;
+	size_t operator()(unsigned __int128 tiles) const;
+};
+
+// visited states of one search, chosen by board size
+template <class P, bool Ranked = P::RANKED>
+class StateSet;
+
+// ranked boards: a bitset and a depth table indexed by canonical rank
+template <class P>
+class StateSet<P, true> {
+public:
+
+	// mark a state as visited, return true if it was not visited before
+	bool visit(const typename P::Board& state);
+
+	// record a path of "depth" moves to a state, return true if no shorter or equal path was recorded
+	bool improve(const typename P::Board& state, int depth);
+
+	// shortest depth recorded for a visited state
+	int depth(const typename P::Board& state) const;
+
+	// mark a state as reached from one side, return the side that reached it first, -1 if it is new
+	int reach(const typename P::Board& state, int side);
+
+	// forget every state
+	void clear();
+
+	// number of states held
+	size_t size() const;
+
+	// bytes held by the bitset and the depth table
+	size_t bytes() const;
+
+private:
+
+	// number of visited bits set
+	size_t count = 0;
+
+	// visited status bitset indexed by canonical rank - fits in about 15 KB
+	std::bitset<P::CANONICAL_SPACE> visited;
+
+	// shortest depth found to (or side that reached) each visited state, only valid where the visited bit is set
+	std::vector<uint8_t> bestDepth = std::vector<uint8_t>(P::CANONICAL_SPACE);
+};
+
+// larger boards: a linear-probing hash table from packed tiles to the shortest depth found
+template <class P>
+class StateSet<P, false> {
+public:
+
+	// mark a state as visited, return true if it was not visited before
+	bool visit(const typename P::Board& state);
+
+	// record a path of "depth" moves to a state, return true if no shorter or equal path was recorded
+	bool improve(const typename P::Board& state, int depth);
+
+	// shortest depth recorded for a visited state
+	int depth(const typename P::Board& state) const;
+
+	// mark a state as reached from one side, return the side that reached it first, -1 if it is new
+	int reach(const typename P::Board& state, int side);
+
+	// forget every state, the table keeps its slots
+	void clear();
+
+	// number of states held
+	size_t size() const;
+
+	// bytes held by the slot table
+	size_t bytes() const;
+
+private:
+
+	// one table entry, empty unless its generation is the current one
+	struct Slot {
+		typename P::Tiles tiles; // packed tiles of the canonical state
+
+		uint32_t generation; // search that stored the state, 0 for never
+
+		uint8_t depth; // shortest depth found to (or side that reached) the state
+	};
+
+	// slot holding a state, or the empty slot where it belongs, growing the table first if it is half full
+	Slot& find(const typename P::Tiles& tiles);
+
+	// double the table and move the current generation's states over
+	void grow();
+
+	// number of states stored by the current generation
+	size_t count = 0;
+
+	// generation of the current search
+	uint32_t generation = 1;
+
+	// power of 2 slots, at most half of them in use
+	std::vector<Slot> slots;
+};
+
+#endif
@@ -0,0 +1,37 @@
+/* Slider Puzzle Work Queues
+*
+* See work_queue.h.
+*
+* File:   work_queue.cpp
+*/
+
+#include "work_queue.h"
+
+using namespace std;
+
+bool takeWork(vector<WorkQueue>& queues, int self, int& index) {
+
+	// own queue first, oldest item first
+	{
+		lock_guard<mutex> guard(queues[self].lock);
+		if (!queues[self].items.empty()) {
+			index = queues[self].items.front();
+			queues[self].items.pop_front();
+			return true;
+		}
+	}
+
+	// steal from the far end of the other queues
+	for (unsigned int k = 1; k < queues.size(); k++) {
+		WorkQueue& victim = queues[(self + k) % queues.size()];
+		lock_guard<mutex> guard(victim.lock);
+		if (!victim.items.empty()) {
+			index = victim.items.back();
+			victim.items.pop_back();
+			return true;
+		}
+	}
+
+	// work is never added while workers take it, so every queue stays empty from now on
+	return false;
+}
@@ -0,0 +1,30 @@
+/* Slider Puzzle Work Queues
+*
+* Work-stealing queues of item indices, one per worker. A worker takes the
+* oldest item of its own queue and, once that runs dry, steals the newest item
+* of another worker's queue, so the workers only contend on a queue when one of
+* them is out of work. Items are all queued before the workers start. Batch
+* mode deals out instances this way and the parallel IDA* its subtrees.
+*
+* File:   work_queue.h
+*/
+
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// item indices owned by one worker, other workers steal from the back
+struct WorkQueue {
+
+	std::mutex lock; // guards items
+
+	std::deque<int> items; // item indices still to take
+};
+
+// take the next item index for a worker: its own queue first, then steal from the others
+bool takeWork(std::vector<WorkQueue>& queues, int self, int& index);
+
+#endif